@@ -50,6 +50,14 @@ namespace Balltze::Events {
          */
         BALLTZE_API static void dispatch(T &event);
 
+        /**
+         * Check if the event has any listener.
+         * Dispatchers check this first to skip building events nobody listens to.
+         * 
+         * @return True if at least one listener is subscribed to the event.
+         */
+        BALLTZE_API static bool has_listeners() noexcept;
+
     protected:
         inline static bool m_initialized = false;
     };
@@ -175,3 +183,4 @@ namespace Balltze::Events {
 #include "events/map.hpp"
 #include "events/input.hpp"
 #include "events/ui_widget.hpp"
+#include "events/deferred.hpp"
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE_API__EVENTS__DEFERRED_HPP
+#define BALLTZE_API__EVENTS__DEFERRED_HPP
+
+#include <functional>
+#include "../api.hpp"
+
+namespace Balltze::Events {
+    enum DeferredTaskTime {
+        DEFERRED_TASK_FRAME_BEGIN,
+        DEFERRED_TASK_TICK
+    };
+
+    using DeferredTask = std::function<void()>;
+
+    /**
+     * Queue a task to run on the main thread.
+     * This can be called from any thread without locking. Tasks run in the order they were queued. They run
+     * before the listeners of the next frame begin or tick. On the dedicated server there are no frames, so
+     * frame begin tasks run on the next tick.
+     * 
+     * @param task  Function to run on the main thread.
+     * @param time  When to run the task.
+     */
+    BALLTZE_API void defer_to_main_thread(DeferredTask task, DeferredTaskTime time = DEFERRED_TASK_FRAME_BEGIN);
+
+    /**
+     * Queue an event to be dispatched on the main thread.
+     * The event is built there from a copy of the given arguments.
+     * 
+     * @param time  When to dispatch the event.
+     * @param args  Arguments of the event constructor.
+     */
+    template<typename T, typename... Args>
+    void defer_event(DeferredTaskTime time, Args... args) {
+        defer_to_main_thread([args...]() {
+            T event(args...);
+            event.dispatch();
+        }, time);
+    }
+}
+
+#endif
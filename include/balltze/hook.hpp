@@ -12,19 +12,26 @@
 #include "api.hpp"
 
 namespace Balltze::Memory {
-    class BALLTZE_API Codecave {
-    private:
-        /** Cave itself */
-        std::unique_ptr<std::byte[]> m_data;
+    /**
+     * Registers a hook saves around the functions it calls.
+     */
+    enum HookRegisters {
+        /** Save nothing; the function must preserve every register and the flags */
+        HOOK_REGISTERS_NONE,
 
-        /** Cave size */
-        std::size_t m_top = 0;
+        /** Save the flags and the registers a __cdecl function may clobber (eax, ecx and edx) */
+        HOOK_REGISTERS_CDECL,
 
-        /** Cave is locked? */
-        bool m_locked = false;
+        /** Save the flags and every general purpose register with pushad; needed by assembly functions that use the pushad frame */
+        HOOK_REGISTERS_ALL
+    };
 
-        /** Original data protection */
-        unsigned long m_original_page_protection;
+    class BALLTZE_API Codecave {
+    private:
+        struct Data;
+
+        /** Cave memory and state; kept out of this header, so plugins do not depend on how caves are allocated */
+        std::unique_ptr<Data> m_data;
 
     public:
         /**
@@ -37,6 +44,11 @@ namespace Balltze::Memory {
          */
         std::byte *data() const noexcept;
 
+        /**
+         * Get the number of bytes reserved for the cave
+         */
+        std::size_t capacity() const noexcept;
+
         /**
          * Check if cave is empty.
          */
@@ -55,9 +67,18 @@ namespace Balltze::Memory {
         /**
          * Set cave as executable
          * @param enable    Enable or disable execute access
+         * @note            Caves are always executable; this does nothing and is only kept for compatibility.
          */
         void enable_execute_access(bool enable = true) noexcept;
 
+        /**
+         * Insert bytes into the cave
+         * @param bytes     Pointer to the bytes
+         * @param size      Number of bytes
+         * @throws std::runtime_error if the bytes do not fit in the cave
+         */
+        void insert_bytes(const void *bytes, std::size_t size);
+
         /**
          * Allocate memory for our cave
          */
@@ -69,54 +90,52 @@ namespace Balltze::Memory {
          */
         Codecave(std::size_t size) noexcept;
 
+        Codecave(const Codecave &) = delete;
+        Codecave &operator=(const Codecave &) = delete;
+        Codecave(Codecave &&) noexcept;
+        Codecave &operator=(Codecave &&) noexcept;
+
+        /**
+         * Give the cave memory back, so another cave can use it
+         */
+        ~Codecave();
+
         /**
          * Insert a byte into the cave
          * @param byte  Byte to insert
+         * @throws std::runtime_error if the cave is full
          */
-        template<typename T> inline void insert(T byte) noexcept {
-            if(m_locked) {
-                return;
-            }
-            m_data[m_top] = static_cast<std::byte>(byte);
-            m_top++;
+        template<typename T> inline void insert(T byte) {
+            auto value = static_cast<std::byte>(byte);
+            insert_bytes(&value, sizeof(value));
         }
 
         /**
          * Insert byte array into cave
          * @param bytes     Pointer to byte array
          * @param lenght    Size of array
+         * @throws std::runtime_error if the bytes do not fit in the cave
          */
-        template<typename T> inline void insert(T *bytes, std::size_t lenght) noexcept {
-            if(m_locked) {
-                return;
-            }
-            for(std::size_t i = 0; i < lenght; i++, m_top++) {
-                m_data[m_top] = reinterpret_cast<const std::byte *>(bytes)[i];
-            }
+        template<typename T> inline void insert(T *bytes, std::size_t lenght) {
+            insert_bytes(bytes, lenght);
         }
 
         /**
          * Insert an address into cave
          * @param address   Address to insert
+         * @throws std::runtime_error if the cave is full
          */
-        inline void insert_address(std::uintptr_t address) noexcept {
-            if(m_locked) {
-                return;
-            }
-            *reinterpret_cast<std::uintptr_t *>(&m_data[m_top]) = address;
-            m_top += 4;
+        inline void insert_address(std::uintptr_t address) {
+            insert_bytes(&address, sizeof(address));
         }
 
         /**
          * Insert an address into cave
          * @param pointer   Pointer to insert
+         * @throws std::runtime_error if the cave is full
          */
-        template<typename T> inline void insert_address(T *pointer) noexcept {
-            if(m_locked) {
-                return;
-            }
-            *reinterpret_cast<std::uintptr_t *>(&m_data[m_top]) = reinterpret_cast<std::uintptr_t>(pointer);
-            m_top += 4;
+        template<typename T> inline void insert_address(T *pointer) {
+            insert_address(reinterpret_cast<std::uintptr_t>(pointer));
         }
     };
 
@@ -139,10 +158,13 @@ namespace Balltze::Memory {
 
         /**
          * Write a function call instruction into cave.
-         * @param function  Function to be called.
-         * @param pushad    Insert pushad and pushfd instructions.
+         * @param function          Function to be called.
+         * @param saved_registers   Registers to save around the call.
+         * @param save_result       Store the result of the function in the skip original code flag.
+         * @return                  Number of bytes written
+         * @throw                   std::runtime_error if the cave is full.
          */
-        void write_function_call(const void *function, bool pushad = true, bool save_result = false) noexcept;
+        std::size_t write_function_call(const void *function, HookRegisters saved_registers = HOOK_REGISTERS_ALL, bool save_result = false);
 
         /**
          * Copy assembly instructions into cave.
@@ -162,8 +184,9 @@ namespace Balltze::Memory {
         /**
          * Write cave return.
          * @param bytes     The amount of bytes to jump
+         * @throw           std::runtime_error if the cave is full.
          */
-        void write_cave_return_jmp() noexcept;
+        void write_cave_return_jmp();
 
     public:
         /**
@@ -196,12 +219,183 @@ namespace Balltze::Memory {
          */
         Hook() = default;
 
+        /**
+         * Constructor for hooks that need a bigger cave than the default one.
+         * @param cave_size     Size of the cave
+         */
+        Hook(std::size_t cave_size) noexcept : m_cave(cave_size) {}
+
         // just friends :')
-        friend Hook *hook_function(void *, std::optional<std::variant<std::function<void()>, std::function<bool()>>>, std::optional<std::function<void()>>, bool, bool);
+        friend class HookTransaction;
+        friend class HookSite;
+        friend Hook *hook_function(void *, std::optional<std::variant<std::function<void()>, std::function<bool()>>>, std::optional<std::function<void()>>, HookRegisters, bool);
         friend Hook *override_function(void *, std::function<void()>, void **, bool);
         friend Hook *replace_function_call(void *, std::function<void()>, bool);
     };
 
+    /**
+     * Function called by a multiplexed hook site
+     */
+    using HookHandler = void (*)();
+
+    /**
+     * Hook shared by every handler of an instruction.
+     * The instruction is patched once; the cave calls a dispatcher that runs an ordered, contiguous array of
+     * handlers before and after the original code, so handlers can be added and removed at any time without
+     * patching the code again. Handlers are called as __cdecl functions and can't skip the original code.
+     */
+    class BALLTZE_API HookSite {
+    private:
+        struct Handler {
+            /** Function to call; null if the handler was removed during a dispatch */
+            HookHandler function;
+
+            /** Handlers with higher priority are called first */
+            int priority;
+
+            /** Handle returned by add_handler */
+            std::size_t handle;
+
+            /** Called after the original code? */
+            bool after;
+        };
+
+        /** Hook of the site */
+        Hook *m_hook;
+
+        /** Handlers called before the original code */
+        std::vector<Handler> m_before_handlers;
+
+        /** Handlers called after the original code */
+        std::vector<Handler> m_after_handlers;
+
+        /** Handlers added during a dispatch; they are added once it ends */
+        std::vector<Handler> m_pending_handlers;
+
+        /** Number of nested dispatches running */
+        std::size_t m_dispatch_depth = 0;
+
+        /** Were handlers removed during a dispatch? */
+        bool m_removed_handlers = false;
+
+        /** Handle for the next handler */
+        std::size_t m_next_handle = 1;
+
+        /**
+         * Add a handler to its array, after every handler with the same or higher priority
+         */
+        void insert_handler(const Handler &handler);
+
+        /**
+         * Called from the cave of the site
+         */
+        static void dispatch_before(HookSite *site) noexcept;
+        static void dispatch_after(HookSite *site) noexcept;
+
+        /**
+         * Run the handlers of the site
+         * @param handlers  Handlers to run
+         */
+        void dispatch(std::vector<Handler> &handlers) noexcept;
+
+    public:
+        /**
+         * Add a handler to the site
+         * @param handler   Function to call
+         * @param after     Call it after the original code instead of before it
+         * @param priority  Handlers with higher priority are called first
+         * @return          Handle to remove the handler
+         * @throws std::invalid_argument if handler is null
+         */
+        std::size_t add_handler(HookHandler handler, bool after = false, int priority = 0);
+
+        /**
+         * Remove a handler from the site
+         * @param handle    Handle returned by add_handler
+         * @return          False if there is no handler with that handle
+         */
+        bool remove_handler(std::size_t handle) noexcept;
+
+        /**
+         * Get the number of handlers of the site
+         */
+        std::size_t handler_count() const noexcept;
+
+        /**
+         * Get the hook of the site
+         */
+        Hook *hook() const noexcept;
+
+        /**
+         * Build the hook of a site; use get_hook_site to get the site of an instruction.
+         * @param instruction   Address of the instruction to hook
+         * @throws std::runtime_error if the instruction is not supported
+         */
+        HookSite(void *instruction);
+
+        HookSite(const HookSite &) = delete;
+        HookSite &operator=(const HookSite &) = delete;
+
+        friend HookSite *get_hook_site(void *, bool);
+    };
+
+    /**
+     * Get the multiplexed hook site of an instruction, creating it if needed.
+     * 
+     * @param instruction           Address of the instruction to hook
+     * @param do_not_hook           Build the hook of a new site but don't hook it yet
+     * @return                      Hook site
+     * @throws std::runtime_error   If instruction is not supported or is already hooked by a regular hook
+     */
+    BALLTZE_API HookSite *get_hook_site(void *instruction, bool do_not_hook = false);
+
+    /**
+     * Install or release a group of hooks at once.
+     * Hooks are built with do_not_hook set and added to the transaction. Committing it patches the code
+     * of all of them with one protection change per group of pages and a single instruction cache flush.
+     * If any of them can't be patched, the code that was already patched is restored and nothing changes.
+     */
+    class BALLTZE_API HookTransaction {
+    private:
+        /** Hooks to install or release */
+        std::vector<Hook *> m_hooks;
+
+        /**
+         * Patch the code of every hook
+         * @param install           Install the hooks if true, release them if false
+         * @param suspend_threads   Suspend every other thread while the code is patched
+         */
+        void apply(bool install, bool suspend_threads);
+
+    public:
+        /**
+         * Add a hook to the transaction
+         * @param hook                  Hook built with do_not_hook set
+         * @throws std::invalid_argument if hook is null or it was already added
+         */
+        void add(Hook *hook);
+
+        /**
+         * Get the number of hooks in the transaction
+         */
+        std::size_t size() const noexcept;
+
+        /**
+         * Install every hook in the transaction
+         * @param suspend_threads       Suspend every other thread of the game while the code is patched;
+         *                              needed when the hooked code may be running on other threads
+         * @throws std::runtime_error   If any hook can't be installed; no hook is installed then
+         */
+        void commit(bool suspend_threads = false);
+
+        /**
+         * Release every hook in the transaction
+         * @param suspend_threads       Suspend every other thread of the game while the code is patched
+         * @throws std::runtime_error   If any hook can't be released; no hook is released then
+         */
+        void revert(bool suspend_threads = false);
+    };
+
     /**
      * Hook a given instruction.
      * Original code can be skipped by returning false in the function_before function.
@@ -217,6 +411,20 @@ namespace Balltze::Memory {
      */
     BALLTZE_API Hook *hook_function(void *instruction, std::optional<std::variant<std::function<void()>, std::function<bool()>>> function_before, std::optional<std::function<void()>> function_after = {}, bool save_registers = true, bool do_not_hook = false);
 
+    /**
+     * Hook a given instruction, saving only the given registers around the functions.
+     * Hooks into C++ functions only need HOOK_REGISTERS_CDECL, which is cheaper than saving every register.
+     * 
+     * @param address               Address of the instruction to hook
+     * @param function_before       Function to be called before original code.
+     * @param function_after        Function to be called after original code
+     * @param saved_registers       Registers to save before calling functions
+     * @param do_not_hook           Build the hook but don't hook it yet
+     * @return                      Hook object
+     * @throws std::runtime_error   If instruction is not supported or is already hooked
+     */
+    BALLTZE_API Hook *hook_function(void *instruction, std::optional<std::variant<std::function<void()>, std::function<bool()>>> function_before, std::optional<std::function<void()>> function_after, HookRegisters saved_registers, bool do_not_hook = false);
+
     /**
      * Override a given function.
      * 
@@ -3,6 +3,7 @@
 #ifndef BALLTZE_LEGACY_API__EVENT_HPP
 #define BALLTZE_LEGACY_API__EVENT_HPP
 
+#include <cstdint>
 #include <functional>
 #include <stdexcept>
 #include "../api.hpp"
@@ -20,6 +21,26 @@ namespace Balltze::LegacyApi::Event {
         EVENT_TIME_AFTER
     };
 
+    enum EventFilterType {
+        EVENT_FILTER_TAG_HANDLE,
+        EVENT_FILTER_TAG_CLASS,
+        EVENT_FILTER_OBJECT_TYPE,
+        EVENT_FILTER_WIDGET_DEFINITION
+    };
+
+    /**
+     * Condition an event has to meet for a listener to be called; it is checked before calling any listener.
+     * The value is a tag handle value, a TagClassInt, an ObjectType or the tag handle value of a widget
+     * definition, depending on the type. Supported filters:
+     * - SoundPlaybackEvent: tag handle of the sound
+     * - ObjectDamageEvent: tag handle of the damage effect; tag class and object type of the damaged object
+     * - UIWidget*Event: widget definition of the widget (or widget list)
+     */
+    struct EventFilter {
+        EventFilterType type;
+        std::uint32_t value;
+    };
+
     template<typename T>
     using EventCallback = std::function<void(T &)>;
 
@@ -32,8 +53,11 @@ namespace Balltze::LegacyApi::Event {
         BALLTZE_API static void init();
         BALLTZE_API static std::size_t add_listener(EventCallback<T> callback, EventPriority priority = EVENT_PRIORITY_DEFAULT);
         BALLTZE_API static std::size_t add_listener_const(ConstEventCallback<T> callback, EventPriority priority = EVENT_PRIORITY_DEFAULT);
+        BALLTZE_API static std::size_t add_listener(EventCallback<T> callback, EventFilter filter, EventPriority priority = EVENT_PRIORITY_DEFAULT);
+        BALLTZE_API static std::size_t add_listener_const(ConstEventCallback<T> callback, EventFilter filter, EventPriority priority = EVENT_PRIORITY_DEFAULT);
         BALLTZE_API static void remove_listener(std::size_t handle);
         BALLTZE_API static void dispatch(T &event);
+        BALLTZE_API static bool has_listeners() noexcept;
     };
 
     template<typename T>
@@ -97,6 +121,18 @@ namespace Balltze::LegacyApi::Event {
             return ListenerHandle(EventHandler<T>::add_listener_const(callback, priority));
         }
 
+        /**
+         * Subscribe to the occurrences of the event that match a filter
+         * @throws std::runtime_error if the event does not support the filter
+         */
+        static ListenerHandle subscribe(EventCallback<T> callback, EventFilter filter, EventPriority priority = EVENT_PRIORITY_DEFAULT) {
+            return ListenerHandle(EventHandler<T>::add_listener(callback, filter, priority));
+        }
+
+        static ListenerHandle subscribe_const(ConstEventCallback<T> callback, EventFilter filter, EventPriority priority = EVENT_PRIORITY_DEFAULT) {
+            return ListenerHandle(EventHandler<T>::add_listener_const(callback, filter, priority));
+        }
+
         static void unsubscribe(ListenerHandle listener) {
             listener.remove();
         }
@@ -295,6 +295,15 @@ namespace Balltze::Memory {
          */
         Signature(std::string name, const short *signature, std::size_t lenght, std::uint16_t offset);
 
+        /**
+         * Constructor for an already resolved signature
+         * @param name      Name for signature
+         * @param address   Address where the signature was found
+         * @param lenght    Number of bytes
+         * @param offset    Offset from the signature
+         */
+        Signature(std::string name, std::byte *address, std::size_t lenght, std::uint16_t offset);
+
     private:
         /** Signature name */
         std::string m_name;
@@ -139,6 +139,16 @@ typedef struct LuastructArray {
 	LuastructArrayDesc *array_info;
 } LuastructArray;
 
+typedef struct LuastructSharedType {
+	const char *name;
+	LuastructTypeInfo *type;
+} LuastructSharedType;
+
+typedef struct LuastructSharedTypes {
+	LuastructSharedType *types; // Sorted by name
+	size_t count;
+} LuastructSharedTypes;
+
 /**
  * Get the types registry.
  * @param state Lua state.
@@ -292,6 +302,23 @@ int luastruct_new_object(lua_State *state, const char *type_name, void *data, bo
  */
 void *luastruct_check_object(lua_State *state, int idx, const char *type_name);
 
+/**
+ * Take a snapshot of the types defined in a state, so other states can use them without defining them again.
+ * The types are still owned by the state, so it must outlive the states using them, and it must not
+ * define more types afterwards.
+ * @param state Lua state with the types.
+ * @return The shared types, or NULL if they could not be allocated.
+ */
+LuastructSharedTypes *luastruct_share_types(lua_State *state);
+
+/**
+ * Make a state look up the types it does not define in a snapshot of shared types.
+ * Each type is added to the types registry of the state, as light userdata, the first time it is used.
+ * @param state Lua state.
+ * @param types Shared types.
+ */
+void luastruct_use_shared_types(lua_State *state, const LuastructSharedTypes *types);
+
 #ifdef __cplusplus
 }
 #endif
@@ -176,8 +176,9 @@ LuastructEnum *luastruct_get_enum(lua_State *state, const char *name) {
         return NULL;
     }
 
-    LuastructEnum *enum_type = luaL_checkudata(state, -1, ENUM_METATABLE_NAME);
-    if(!enum_type) {
+    // Shared types are light userdata, so check the type info instead of the metatable
+    LuastructEnum *enum_type = lua_touserdata(state, -1);
+    if(!enum_type || enum_type->type_info.type != LUAST_ENUM) {
         lua_pop(state, 2);
         return NULL;
     }
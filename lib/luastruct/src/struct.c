@@ -133,11 +133,85 @@ int luastruct_get_types_registry(lua_State *state) {
         lua_newtable(state);
         lua_pushvalue(state, -1);
         lua_setfield(state, LUA_REGISTRYINDEX, types_registry_name);
-        lua_getfield(state, LUA_REGISTRYINDEX, types_registry_name);
     }
     return 1;
 }
 
+static int compare_shared_types(const void *a, const void *b) {
+    const LuastructSharedType *type_a = a;
+    const LuastructSharedType *type_b = b;
+    return strcmp(type_a->name, type_b->name);
+}
+
+LuastructSharedTypes *luastruct_share_types(lua_State *state) {
+    size_t count = 0;
+    luastruct_get_types_registry(state);
+    lua_pushnil(state);
+    while(lua_next(state, -2) != 0) {
+        count++;
+        lua_pop(state, 1);
+    }
+
+    LuastructSharedTypes *types = malloc(sizeof(LuastructSharedTypes));
+    LuastructSharedType *entries = malloc(sizeof(LuastructSharedType) * (count > 0 ? count : 1));
+    if(!types || !entries) {
+        free(types);
+        free(entries);
+        lua_pop(state, 1);
+        return NULL;
+    }
+
+    size_t index = 0;
+    lua_pushnil(state);
+    while(lua_next(state, -2) != 0) {
+        LuastructTypeInfo *type_info = lua_touserdata(state, -1);
+        if(type_info) {
+            entries[index].name = type_info->name;
+            entries[index].type = type_info;
+            index++;
+        }
+        lua_pop(state, 1);
+    }
+    lua_pop(state, 1);
+
+    qsort(entries, index, sizeof(LuastructSharedType), compare_shared_types);
+    types->types = entries;
+    types->count = index;
+    return types;
+}
+
+static int luastruct_shared_types__index(lua_State *state) {
+    const LuastructSharedTypes *types = lua_touserdata(state, lua_upvalueindex(1));
+    if(lua_type(state, 2) != LUA_TSTRING) {
+        lua_pushnil(state);
+        return 1;
+    }
+
+    LuastructSharedType key = { lua_tostring(state, 2), NULL };
+    const LuastructSharedType *type = bsearch(&key, types->types, types->count, sizeof(LuastructSharedType), compare_shared_types);
+    if(!type) {
+        lua_pushnil(state);
+        return 1;
+    }
+
+    // Keep it in the registry, so the next lookups do not get here
+    lua_pushlightuserdata(state, type->type);
+    lua_pushvalue(state, 2);
+    lua_pushvalue(state, -2);
+    lua_rawset(state, 1);
+    return 1;
+}
+
+void luastruct_use_shared_types(lua_State *state, const LuastructSharedTypes *types) {
+    luastruct_get_types_registry(state);
+    lua_newtable(state);
+    lua_pushlightuserdata(state, (void *)types);
+    lua_pushcclosure(state, luastruct_shared_types__index, 1);
+    lua_setfield(state, -2, "__index");
+    lua_setmetatable(state, -2);
+    lua_pop(state, 1);
+}
+
 int luastruct_struct__gc(lua_State *state) {
     LuastructStruct *st = luaL_checkudata(state, 1, STRUCT_METATABLE_NAME);
     if(!st) {
@@ -159,8 +233,11 @@ int luastruct_new_struct(lua_State *state, const char *name, const char *super_n
         if(luastruct_get_type(state, super_name) == 0) {
             return luaL_error(state, "Super struct type does not exist: %s", super_name);
         }
-        super = luaL_checkudata(state, -1, STRUCT_METATABLE_NAME);
+        super = lua_touserdata(state, -1);
         lua_pop(state, 1); 
+        if(!super || super->type_info.type != LUAST_STRUCT) {
+            return luaL_error(state, "Super type is not a struct: %s", super_name);
+        }
     }
 
     if(strlen(name) >= LUASTRUCT_TYPENAME_LENGTH) {
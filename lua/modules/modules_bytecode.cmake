@@ -0,0 +1,46 @@
+# SPDX-License-Identifier: GPL-3.0-only
+
+include(ExternalProject)
+
+# The bytecode compiler runs during the build, so it is built for the host even when cross compiling
+set(NATIVE_TOOLS_PATH "${CMAKE_BINARY_DIR}/native_tools")
+if(CMAKE_HOST_WIN32)
+    set(LUA_BYTECODE_COMPILER "${NATIVE_TOOLS_PATH}/lua-bytecode-compiler.exe")
+else()
+    set(LUA_BYTECODE_COMPILER "${NATIVE_TOOLS_PATH}/lua-bytecode-compiler")
+endif()
+
+ExternalProject_Add(native-tools
+    SOURCE_DIR ${CMAKE_CURRENT_SOURCE_DIR}
+    BINARY_DIR ${NATIVE_TOOLS_PATH}
+    CMAKE_ARGS -DBALLTZE_NATIVE_TOOLS_ONLY=ON -DCMAKE_BUILD_TYPE=Release
+    BUILD_COMMAND ${CMAKE_COMMAND} --build . --target lua-bytecode-compiler
+    BUILD_BYPRODUCTS ${LUA_BYTECODE_COMPILER}
+    INSTALL_COMMAND ""
+)
+
+# Embedded modules
+set(LUA_MODULES_PATH "${CMAKE_CURRENT_SOURCE_DIR}/lua/modules")
+set(LUA_MODULES_BYTECODE_PATH "${CMAKE_BINARY_DIR}/lua_modules")
+set(LUA_MODULES json luna inspect lanes)
+set(LUA_MODULES_BYTECODE_FILES)
+
+# Keep line numbers in error messages unless building for release
+set(LUA_BYTECODE_COMPILER_FLAGS --size-t ${CMAKE_SIZEOF_VOID_P})
+if(CMAKE_BUILD_TYPE MATCHES Release OR CMAKE_BUILD_TYPE MATCHES MinSizeRel)
+    list(APPEND LUA_BYTECODE_COMPILER_FLAGS --strip)
+endif()
+
+file(MAKE_DIRECTORY ${LUA_MODULES_BYTECODE_PATH})
+foreach(MODULE ${LUA_MODULES})
+    set(MODULE_BYTECODE_FILE "${LUA_MODULES_BYTECODE_PATH}/${MODULE}.luac")
+    add_custom_command(
+        OUTPUT ${MODULE_BYTECODE_FILE}
+        COMMAND ${LUA_BYTECODE_COMPILER} ${LUA_BYTECODE_COMPILER_FLAGS} ${LUA_MODULES_PATH}/${MODULE}.lua ${MODULE_BYTECODE_FILE} ${MODULE}
+        DEPENDS ${LUA_MODULES_PATH}/${MODULE}.lua native-tools
+        COMMENT "Compiling Lua module ${MODULE}"
+    )
+    list(APPEND LUA_MODULES_BYTECODE_FILES ${MODULE_BYTECODE_FILE})
+endforeach()
+
+add_custom_target(lua-modules-bytecode DEPENDS ${LUA_MODULES_BYTECODE_FILES})
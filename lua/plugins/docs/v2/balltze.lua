@@ -41,6 +41,19 @@ function Balltze.setClipboard(content) end
 ---@return string Content from the clipboard
 function Balltze.getClipboard() end
 
+---@class BalltzeMemoryStats
+---@field liveBytes integer Bytes in use by the Lua state
+---@field peakBytes integer Highest number of bytes the Lua state has used
+---@field reservedBytes integer Bytes reserved by the allocator of the Lua state
+---@field liveAllocations integer Number of blocks in use
+---@field allocations integer Number of allocations done so far
+---@field failedAllocations integer Number of allocations refused because of the memory limit or because the heap ran out
+---@field limit integer Memory limit of the Lua state in bytes; 0 means no limit
+
+---Get memory usage of the plugin's Lua state
+---@return BalltzeMemoryStats Memory stats of the Lua state
+function Balltze.getMemoryStats() end
+
 
 -------------------------------------------------------
 -- Configurations functions
@@ -10,8 +10,10 @@
 #include <impl/terminal/terminal.h>
 #include <ringworld.h>
 #include "events/events.hpp"
+#include "events/listener_profiler.hpp"
 #include "features/features.hpp"
 #include "legacy_api/event/event.hpp"
+#include "memory/hook_profiler.hpp"
 #include "memory/memory.hpp"
 #include "plugins/loader.hpp"
 #include "command/command.hpp"
@@ -78,6 +80,10 @@ namespace Balltze {
             Events::set_up_events_handlers();
             set_up_commands();
             register_ringworld_commands();
+            Events::set_up_listener_profiler();
+#ifdef BALLTZE_HOOK_PROFILING
+            Memory::set_up_hook_profiler();
+#endif
             Features::set_up_features();
             Plugins::set_up_plugins_loader();
 
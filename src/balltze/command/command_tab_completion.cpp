@@ -9,6 +9,7 @@
 #include <balltze/command.hpp>
 #include "../logger.hpp"
 #include "command.hpp"
+#include "../memory/memory.hpp"
 
 namespace Balltze {
     using HscFunctionEntry = LegacyApi::Engine::HscFunctionEntry;
@@ -50,7 +51,7 @@ namespace Balltze {
     }
 
     void set_up_commands_tab_completion() {
-        auto *console_tab_completion_function_call_sig = Memory::get_signature("console_tab_completion_function_call");
+        auto *console_tab_completion_function_call_sig = Memory::get_signature(Memory::SIGNATURE_CONSOLE_TAB_COMPLETION_FUNCTION_CALL);
         if(!console_tab_completion_function_call_sig) {
             throw std::runtime_error("Could not find signature for tab completion");
         }
@@ -70,7 +71,7 @@ namespace Balltze {
             throw std::runtime_error("Could not hook tab completion function: " + std::string(e.what()));
         }
 
-        auto *command_list_address_custom_edition_sig = Memory::get_signature("command_list_address_custom_edition");
+        auto *command_list_address_custom_edition_sig = Memory::get_signature(Memory::SIGNATURE_COMMAND_LIST_ADDRESS_CUSTOM_EDITION);
         entries = reinterpret_cast<HscFunctionEntry ***>(command_list_address_custom_edition_sig->data());
         entry_count = reinterpret_cast<std::uint32_t *>(command_list_address_custom_edition_sig->data() + 5);
     }
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <stdexcept>
+#include <balltze/api.hpp>
+#include <balltze/events/deferred.hpp>
+#include "../logger.hpp"
+#include "inline_callback.hpp"
+#include "mpsc_queue.hpp"
+#include "deferred.hpp"
+
+namespace Balltze::Events {
+    static MpscQueue<InlineCallback<void()>> frame_begin_tasks;
+    static MpscQueue<InlineCallback<void()>> tick_tasks;
+
+    void defer_to_main_thread(DeferredTask task, DeferredTaskTime time) {
+        if(!task) {
+            throw std::invalid_argument("task must be a valid function");
+        }
+        if(time == DEFERRED_TASK_FRAME_BEGIN && get_balltze_side() == BALLTZE_SIDE_CLIENT) {
+            frame_begin_tasks.push(std::move(task));
+        }
+        else {
+            tick_tasks.push(std::move(task));
+        }
+    }
+
+    void run_deferred_tasks(DeferredTaskTime time) noexcept {
+        auto &tasks = time == DEFERRED_TASK_FRAME_BEGIN ? frame_begin_tasks : tick_tasks;
+
+        // Tasks queued by these tasks wait for the next frame or tick
+        auto count = tasks.size();
+        for(std::size_t i = 0; i < count; i++) {
+            auto task = tasks.pop();
+            if(!task) {
+                break;
+            }
+            try {
+                (*task)();
+            }
+            catch(std::exception &e) {
+                logger.error("Deferred task failed: {}", e.what());
+            }
+        }
+    }
+}
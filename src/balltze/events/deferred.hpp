@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__EVENTS__DEFERRED_HPP
+#define BALLTZE__EVENTS__DEFERRED_HPP
+
+#include <balltze/events/deferred.hpp>
+
+namespace Balltze::Events {
+    /**
+     * Run the tasks queued for a time; only call from the main thread.
+     * @param time  Frame begin or tick
+     */
+    void run_deferred_tasks(DeferredTaskTime time) noexcept;
+}
+
+#endif
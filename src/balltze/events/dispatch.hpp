@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__EVENTS__DISPATCH_HPP
+#define BALLTZE__EVENTS__DISPATCH_HPP
+
+#include <cstddef>
+#include <balltze/events/input.hpp>
+
+namespace Balltze::Events {
+    /**
+     * Dispatchers of the events that share an engine hook with the legacy API.
+     * The legacy dispatchers call them after their own listeners, so the hook fires once for both APIs.
+     */
+    void dispatch_frame_begin_event();
+    void dispatch_frame_end_event();
+    void dispatch_tick_event();
+    void dispatch_map_load_event(const char *map_name);
+    void dispatch_map_loaded_event(const char *map_name);
+    bool dispatch_player_input_event(PlayerInputEvent::InputDevice device, std::size_t key_code, bool mapped);
+    bool dispatch_player_input_event(PlayerInputEvent::InputDevice device, PlayerInputEvent::GamepadButton gamepad_button, bool mapped);
+}
+
+#endif
@@ -1,30 +1,33 @@
 // SPDX-License-Identifier: GPL-3.0-only
 
 #include <balltze/events/frame.hpp>
-#include <balltze/legacy_api/events/d3d9.hpp>
+#include "deferred.hpp"
+#include "dispatch.hpp"
 
 namespace Balltze::Events {
     void dispatch_frame_begin_event() {
+        run_deferred_tasks(DEFERRED_TASK_FRAME_BEGIN);
+        if(!EventHandler<FrameBeginEvent>::has_listeners()) {
+            return;
+        }
         FrameBeginEvent event;
         event.dispatch();
     }
 
     template<>
     void EventHandler<FrameBeginEvent>::init() {
-        static bool enabled = false;
-        if(enabled) {
+        if(m_initialized) {
             return;
         }
-        enabled = true;
+        m_initialized = true;
 
-        LegacyApi::Event::D3D9BeginSceneEvent::subscribe([](auto &event) {
-            if(event.time == LegacyApi::Event::EVENT_TIME_BEFORE) {
-                dispatch_frame_begin_event();
-            }
-        });
+        // Dispatched from the D3D9 begin scene hook, which is set up on the first tick
     }
 
     void dispatch_frame_end_event() {
+        if(!EventHandler<FrameEndEvent>::has_listeners()) {
+            return;
+        }
         FrameEndEvent event;
         event.dispatch();
     }
@@ -36,10 +39,6 @@ namespace Balltze::Events {
         }
         m_initialized = true;
 
-        LegacyApi::Event::D3D9EndSceneEvent::subscribe([](auto &event) {
-            if(event.time == LegacyApi::Event::EVENT_TIME_BEFORE) {
-                dispatch_frame_end_event();
-            }
-        });
+        // Dispatched from the D3D9 end scene hook, which is set up on the first tick
     }
 }
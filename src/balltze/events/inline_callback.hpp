@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__EVENTS__INLINE_CALLBACK_HPP
+#define BALLTZE__EVENTS__INLINE_CALLBACK_HPP
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Balltze::Events {
+    template<typename Signature, std::size_t buffer_size = sizeof(void *) * 4>
+    class InlineCallback;
+
+    template<typename T>
+    inline constexpr bool is_std_function = false;
+
+    template<typename Signature>
+    inline constexpr bool is_std_function<std::function<Signature>> = true;
+
+    /**
+     * Callback stored in place, so calling it never touches the heap.
+     * Plain functions are called straight through their pointer. Callables that fit in the buffer are
+     * stored inline; bigger ones are allocated once, when the callback is built. A std::function that
+     * wraps a plain function is unwrapped, and any other one is kept inline, since it fits the buffer.
+     */
+    template<typename... Args, std::size_t buffer_size>
+    class InlineCallback<void(Args...), buffer_size> {
+    private:
+        using Function = void (*)(Args...);
+        using Invoker = void (*)(void *storage, Args... args);
+        using Manager = void (*)(void *destination, void *source) noexcept;
+
+        /** Plain function to call; set instead of the invoker */
+        Function m_function = nullptr;
+
+        /** Calls the callable in the buffer */
+        Invoker m_invoker = nullptr;
+
+        /** Moves the callable to another buffer, or destroys it if there is no destination */
+        Manager m_manager = nullptr;
+
+        alignas(std::max_align_t) std::byte m_storage[buffer_size];
+
+        template<typename Callable>
+        static constexpr bool stored_inline = sizeof(Callable) <= buffer_size && alignof(Callable) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Callable>;
+
+        template<typename Callable>
+        void store(Callable &&callable) {
+            using Stored = std::decay_t<Callable>;
+            if constexpr(stored_inline<Stored>) {
+                new (m_storage) Stored(std::forward<Callable>(callable));
+                m_invoker = [](void *storage, Args... args) {
+                    (*std::launder(reinterpret_cast<Stored *>(storage)))(std::forward<Args>(args)...);
+                };
+                m_manager = [](void *destination, void *source) noexcept {
+                    auto *stored = std::launder(reinterpret_cast<Stored *>(source));
+                    if(destination) {
+                        new (destination) Stored(std::move(*stored));
+                    }
+                    stored->~Stored();
+                };
+            }
+            else {
+                auto *stored = new Stored(std::forward<Callable>(callable));
+                new (m_storage) Stored *(stored);
+                m_invoker = [](void *storage, Args... args) {
+                    (**std::launder(reinterpret_cast<Stored **>(storage)))(std::forward<Args>(args)...);
+                };
+                m_manager = [](void *destination, void *source) noexcept {
+                    auto *stored = *std::launder(reinterpret_cast<Stored **>(source));
+                    if(destination) {
+                        new (destination) Stored *(stored);
+                    }
+                    else {
+                        delete stored;
+                    }
+                };
+            }
+        }
+
+        void move_from(InlineCallback &other) noexcept {
+            m_function = other.m_function;
+            m_invoker = other.m_invoker;
+            m_manager = other.m_manager;
+            if(m_manager) {
+                m_manager(m_storage, other.m_storage);
+            }
+            other.m_function = nullptr;
+            other.m_invoker = nullptr;
+            other.m_manager = nullptr;
+        }
+
+        void reset() noexcept {
+            if(m_manager) {
+                m_manager(nullptr, m_storage);
+            }
+            m_function = nullptr;
+            m_invoker = nullptr;
+            m_manager = nullptr;
+        }
+
+    public:
+        InlineCallback() noexcept = default;
+
+        InlineCallback(std::nullptr_t) noexcept {}
+
+        InlineCallback(Function function) noexcept : m_function(function) {}
+
+        template<typename Signature>
+        InlineCallback(std::function<Signature> function) {
+            if(!function) {
+                return;
+            }
+            if(auto *target = function.template target<Function>()) {
+                m_function = *target;
+            }
+            else {
+                store(std::move(function));
+            }
+        }
+
+        template<typename Callable, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, InlineCallback> && !is_std_function<std::decay_t<Callable>> && std::is_invocable_v<Callable &, Args...>>>
+        InlineCallback(Callable &&callable) {
+            using Stored = std::decay_t<Callable>;
+            if constexpr(std::is_convertible_v<Stored, Function>) {
+                m_function = static_cast<Function>(callable);
+            }
+            else {
+                store(std::forward<Callable>(callable));
+            }
+        }
+
+        InlineCallback(InlineCallback &&other) noexcept {
+            move_from(other);
+        }
+
+        InlineCallback &operator=(InlineCallback &&other) noexcept {
+            if(this != &other) {
+                reset();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        InlineCallback(const InlineCallback &) = delete;
+        InlineCallback &operator=(const InlineCallback &) = delete;
+
+        ~InlineCallback() {
+            reset();
+        }
+
+        /**
+         * Call the callback
+         */
+        void operator()(Args... args) {
+            if(m_function) {
+                m_function(std::forward<Args>(args)...);
+            }
+            else {
+                m_invoker(m_storage, std::forward<Args>(args)...);
+            }
+        }
+
+        /**
+         * Check if the callback has something to call
+         */
+        explicit operator bool() const noexcept {
+            return m_function || m_invoker;
+        }
+    };
+}
+
+#endif
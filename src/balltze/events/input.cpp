@@ -2,15 +2,22 @@
 
 #include <balltze/events/input.hpp>
 #include <balltze/legacy_api/events/game_input.hpp>
+#include "dispatch.hpp"
 
 namespace Balltze::Events {
     bool dispatch_player_input_event(PlayerInputEvent::InputDevice device, std::size_t key_code, bool mapped) {
+        if(!EventHandler<PlayerInputEvent>::has_listeners()) {
+            return false;
+        }
         PlayerInputEvent event(device, key_code, mapped);
         event.dispatch();
         return event.cancelled();
     }
 
     bool dispatch_player_input_event(PlayerInputEvent::InputDevice device, PlayerInputEvent::GamepadButton gamepad_button, bool mapped) {
+        if(!EventHandler<PlayerInputEvent>::has_listeners()) {
+            return false;
+        }
         PlayerInputEvent event(device, gamepad_button, mapped);
         event.dispatch();
         return event.cancelled();
@@ -45,19 +52,7 @@ namespace Balltze::Events {
         }
         m_initialized = true;
 
-        LegacyApi::Event::GameInputEvent::subscribe([](auto &event) {
-            if(event.time == LegacyApi::Event::EVENT_TIME_BEFORE) {
-                bool cancelled = false;
-                if(event.context.device == LegacyApi::Engine::INPUT_DEVICE_KEYBOARD) {
-                    cancelled = dispatch_player_input_event(event.context.device, event.context.button.key_code, event.context.mapped);
-                }
-                else if(event.context.device == LegacyApi::Engine::INPUT_DEVICE_GAMEPAD) {
-                    cancelled = dispatch_player_input_event(event.context.device, event.context.button.gamepad_button, event.context.mapped);
-                }
-                if(cancelled) {
-                    event.cancel();
-                }
-            }
-        });
+        // The legacy input hooks dispatch this event after their own listeners
+        LegacyApi::Event::EventHandler<LegacyApi::Event::GameInputEvent>::init();
     }
 }
@@ -0,0 +1,301 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <cxxabi.h>
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <optional>
+#include <typeindex>
+#include <utility>
+#include <vector>
+#include <balltze/events/frame.hpp>
+#include <balltze/utils.hpp>
+#include <impl/terminal/terminal.h>
+#include "../command/command.hpp"
+#include "../plugins/loader.hpp"
+#include "../logger.hpp"
+#include "listener_profiler.hpp"
+
+#define DEFAULT_PRINTED_LISTENER_PROFILES 10
+#define DEFAULT_LISTENER_FRAME_BUDGET 1000
+#define LISTENER_PROFILER_REPORT_INTERVAL std::chrono::seconds(10)
+
+namespace Balltze::Events {
+    static std::deque<ListenerProfile> profiles;
+    static std::map<std::pair<std::type_index, HMODULE>, ListenerProfile *> profiles_by_event;
+    static std::map<std::pair<std::type_index, std::string>, ListenerProfile *> lua_profiles_by_event;
+    static std::uint64_t frame_budget = DEFAULT_LISTENER_FRAME_BUDGET * 1000;
+    static std::chrono::steady_clock::time_point last_report;
+    static std::optional<FrameBeginEvent::ListenerHandle> frame_listener;
+
+    static std::string event_type_name(const std::type_info &event_type) {
+        int status;
+        char *demangled_name = abi::__cxa_demangle(event_type.name(), nullptr, nullptr, &status);
+        std::string name = status == 0 && demangled_name ? demangled_name : event_type.name();
+        std::free(demangled_name);
+
+        const std::string prefix = "Balltze::";
+        if(name.compare(0, prefix.size(), prefix) == 0) {
+            name.erase(0, prefix.size());
+        }
+        return name;
+    }
+
+    static std::string module_owner_name(HMODULE module) {
+        if(module == get_current_module()) {
+            return "balltze";
+        }
+        if(auto *plugin = Plugins::get_dll_plugin(module)) {
+            return plugin->name();
+        }
+        return "unknown";
+    }
+
+    static std::string profile_owner_name(const ListenerProfile &profile) {
+        if(!profile.lua_plugin.empty()) {
+            return profile.lua_plugin;
+        }
+        return module_owner_name(profile.module);
+    }
+
+    ListenerProfile *get_listener_profile(const std::type_info &event_type, HMODULE module) {
+        auto key = std::make_pair(std::type_index(event_type), module);
+        auto it = profiles_by_event.find(key);
+        if(it != profiles_by_event.end()) {
+            return it->second;
+        }
+        auto *profile = &profiles.emplace_back();
+        profile->event_name = event_type_name(event_type);
+        profile->module = module;
+        profiles_by_event.emplace(key, profile);
+        return profile;
+    }
+
+    ListenerProfile *get_lua_listener_profile(const std::type_info &event_type, const std::string &plugin_name) {
+        auto key = std::make_pair(std::type_index(event_type), plugin_name);
+        auto it = lua_profiles_by_event.find(key);
+        if(it != lua_profiles_by_event.end()) {
+            return it->second;
+        }
+        auto *profile = &profiles.emplace_back();
+        profile->event_name = event_type_name(event_type);
+        profile->module = get_current_module();
+        profile->lua_plugin = plugin_name;
+        lua_profiles_by_event.emplace(std::move(key), profile);
+        return profile;
+    }
+
+    static std::size_t histogram_bucket(std::uint64_t time) noexcept {
+        if(time < 4) {
+            return time;
+        }
+        std::size_t exponent = 63 - std::countl_zero(time);
+        std::size_t fraction = (time >> (exponent - 2)) & 3;
+        return std::min<std::size_t>(exponent * 4 + fraction, LISTENER_PROFILE_BUCKET_COUNT - 1);
+    }
+
+    static std::uint64_t histogram_bucket_limit(std::size_t bucket) noexcept {
+        if(bucket < 4) {
+            return bucket;
+        }
+        std::size_t exponent = bucket / 4;
+        std::size_t fraction = bucket % 4;
+        return ((5 + fraction) << (exponent - 2)) - 1;
+    }
+
+    void record_listener_call(ListenerProfile *profile, std::uint64_t time) noexcept {
+        profile->calls++;
+        profile->total_time += time;
+        profile->max_time = std::max<std::uint64_t>(profile->max_time, time);
+        profile->histogram[histogram_bucket(time)]++;
+        profile->frame_time += time;
+    }
+
+    static std::uint64_t percentile_time(const ListenerProfile &profile, double percentile) noexcept {
+        auto target_calls = static_cast<std::uint64_t>(profile.calls * percentile + 0.5);
+        std::uint64_t calls = 0;
+        for(std::size_t i = 0; i < profile.histogram.size(); i++) {
+            calls += profile.histogram[i];
+            if(calls >= target_calls) {
+                return std::min<std::uint64_t>(histogram_bucket_limit(i), profile.max_time);
+            }
+        }
+        return profile.max_time;
+    }
+
+    static double to_microseconds(std::uint64_t time) noexcept {
+        return time / 1000.0;
+    }
+
+    static void reset_profiles() noexcept {
+        for(auto &profile : profiles) {
+            profile.calls = 0;
+            profile.total_time = 0;
+            profile.max_time = 0;
+            profile.histogram.fill(0);
+            profile.frame_time = 0;
+            profile.frames_over_budget = 0;
+            profile.max_frame_time = 0;
+        }
+    }
+
+    /**
+     * Check the time spent by the listeners in the last frame, and log the ones over the budget now and then.
+     */
+    static void check_frame_budget(FrameBeginEvent &event) {
+        for(auto &profile : profiles) {
+            if(profile.frame_time > frame_budget) {
+                profile.frames_over_budget++;
+                profile.max_frame_time = std::max<std::uint64_t>(profile.max_frame_time, profile.frame_time);
+            }
+            profile.frame_time = 0;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if(now - last_report < LISTENER_PROFILER_REPORT_INTERVAL) {
+            return;
+        }
+        last_report = now;
+
+        for(auto &profile : profiles) {
+            if(profile.frames_over_budget == 0) {
+                continue;
+            }
+            logger.warning("{} listeners of {} went over the frame budget of {} us in {} frames (longest frame: {:.1f} us)", profile_owner_name(profile), profile.event_name, frame_budget / 1000, profile.frames_over_budget, to_microseconds(profile.max_frame_time));
+            profile.frames_over_budget = 0;
+            profile.max_frame_time = 0;
+        }
+    }
+
+    static void set_listener_profiling(bool enable) {
+        if(enable == listener_profiling_enabled) {
+            return;
+        }
+        listener_profiling_enabled = enable;
+        if(enable) {
+            last_report = std::chrono::steady_clock::now();
+            frame_listener = FrameBeginEvent::subscribe(check_frame_budget, EVENT_PRIORITY_HIGHEST);
+        }
+        else if(frame_listener) {
+            frame_listener->remove();
+            frame_listener.reset();
+        }
+    }
+
+    static void print_profiles(const std::vector<const ListenerProfile *> &sorted_profiles, std::size_t count) {
+        terminal_info_printf("Listeners by total time:");
+        for(std::size_t i = 0; i < sorted_profiles.size() && i < count; i++) {
+            auto &profile = *sorted_profiles[i];
+            auto owner = profile_owner_name(profile);
+            terminal_info_printf("%2zu. %s (%s): %llu calls, %.1f us total, %.1f us max, %.1f us p99", i + 1, profile.event_name.c_str(), owner.c_str(), profile.calls, to_microseconds(profile.total_time), to_microseconds(profile.max_time), to_microseconds(percentile_time(profile, 0.99)));
+        }
+
+        std::map<std::string, std::uint64_t> time_by_owner;
+        for(auto *profile : sorted_profiles) {
+            time_by_owner[profile_owner_name(*profile)] += profile->total_time;
+        }
+        std::vector<std::pair<std::string, std::uint64_t>> sorted_owners(time_by_owner.begin(), time_by_owner.end());
+        std::sort(sorted_owners.begin(), sorted_owners.end(), [](auto &a, auto &b) {
+            return a.second > b.second;
+        });
+        terminal_info_printf("Listeners by owner:");
+        for(auto &[owner, time] : sorted_owners) {
+            terminal_info_printf("%s: %.1f us total", owner.c_str(), to_microseconds(time));
+        }
+    }
+
+    void set_up_listener_profiler() {
+        CommandBuilder()
+            .name("event_profiler")
+            .category("debug")
+            .help("Sets whether to time every event listener.")
+            .param(HSC_DATA_TYPE_BOOLEAN, "enable")
+            .function([](const std::vector<std::string> &args) -> bool {
+                set_listener_profiling(STR_TO_BOOL(args[0].c_str()));
+                terminal_info_printf("Event listener profiling is %s", BOOL_TO_STR(listener_profiling_enabled));
+                return true;
+            })
+            .autosave()
+            .default_value("false")
+            .can_call_from_console()
+            .is_core()
+            .create(COMMAND_SOURCE_BALLTZE);
+
+        CommandBuilder()
+            .name("event_profiler_budget")
+            .category("debug")
+            .help("Sets the microseconds the listeners of an event from a plugin may take per frame before being reported.")
+            .param(HSC_DATA_TYPE_LONG, "microseconds")
+            .function([](const std::vector<std::string> &args) -> bool {
+                auto budget = std::stol(args[0]);
+                if(budget <= 0) {
+                    terminal_error_printf("Budget must be greater than zero");
+                    return false;
+                }
+                frame_budget = static_cast<std::uint64_t>(budget) * 1000;
+                terminal_info_printf("Event listener frame budget is %ld us", budget);
+                return true;
+            })
+            .autosave()
+            .default_value(std::to_string(DEFAULT_LISTENER_FRAME_BUDGET))
+            .can_call_from_console()
+            .is_core()
+            .create(COMMAND_SOURCE_BALLTZE);
+
+        CommandBuilder()
+            .name("event_profile")
+            .category("debug")
+            .help("Prints the event listeners with the most time spent, by event and owner.")
+            .param(HSC_DATA_TYPE_SHORT, "count", true)
+            .function([](const std::vector<std::string> &args) -> bool {
+                std::size_t count = DEFAULT_PRINTED_LISTENER_PROFILES;
+                if(args.size() == 1) {
+                    auto requested_count = std::stoi(args[0]);
+                    if(requested_count <= 0) {
+                        terminal_error_printf("Count must be greater than zero");
+                        return false;
+                    }
+                    count = requested_count;
+                }
+
+                std::vector<const ListenerProfile *> sorted_profiles;
+                for(auto &profile : profiles) {
+                    if(profile.calls > 0) {
+                        sorted_profiles.push_back(&profile);
+                    }
+                }
+                if(sorted_profiles.empty()) {
+                    if(!listener_profiling_enabled) {
+                        terminal_info_printf("Event listener profiling is disabled; enable it with event_profiler");
+                    }
+                    else {
+                        terminal_info_printf("No event listener has been called yet");
+                    }
+                    return true;
+                }
+
+                std::sort(sorted_profiles.begin(), sorted_profiles.end(), [](auto *a, auto *b) {
+                    return a->total_time > b->total_time;
+                });
+                print_profiles(sorted_profiles, count);
+                return true;
+            })
+            .can_call_from_console()
+            .is_core()
+            .create(COMMAND_SOURCE_BALLTZE);
+
+        CommandBuilder()
+            .name("event_profile_reset")
+            .category("debug")
+            .help("Clears the event listener timings.")
+            .function([](const std::vector<std::string> &args) -> bool {
+                reset_profiles();
+                return true;
+            })
+            .can_call_from_console()
+            .is_core()
+            .create(COMMAND_SOURCE_BALLTZE);
+    }
+}
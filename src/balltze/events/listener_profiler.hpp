@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__EVENTS__LISTENER_PROFILER_HPP
+#define BALLTZE__EVENTS__LISTENER_PROFILER_HPP
+
+#include <windows.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <typeinfo>
+#include "inline_callback.hpp"
+
+#define LISTENER_PROFILE_BUCKET_COUNT 160
+
+namespace Balltze::Events {
+    /**
+     * Time spent in the listeners of an event that belong to the same module.
+     */
+    struct ListenerProfile {
+        /** Name of the event type */
+        std::string event_name;
+
+        /** Module the listeners were added from */
+        HMODULE module;
+
+        /** Lua plugin the listeners belong to; empty for native listeners */
+        std::string lua_plugin;
+
+        /** Number of calls */
+        std::uint64_t calls = 0;
+
+        /** Nanoseconds spent in the calls */
+        std::uint64_t total_time = 0;
+
+        /** Longest call, in nanoseconds */
+        std::uint64_t max_time = 0;
+
+        /** Calls by duration; four buckets per power of two nanoseconds */
+        std::array<std::uint32_t, LISTENER_PROFILE_BUCKET_COUNT> histogram = {};
+
+        /** Nanoseconds spent in the current frame */
+        std::uint64_t frame_time = 0;
+
+        /** Frames over the budget since the last report */
+        std::uint32_t frames_over_budget = 0;
+
+        /** Longest frame since the last report, in nanoseconds */
+        std::uint64_t max_frame_time = 0;
+    };
+
+    /**
+     * Listener with the profile of its event and module
+     */
+    template<typename T>
+    struct ProfiledListener {
+        InlineCallback<void(T &)> callback;
+        ListenerProfile *profile;
+    };
+
+    /**
+     * Whether listeners are being timed; set with the event_profiler command
+     */
+    inline bool listener_profiling_enabled = false;
+
+    /**
+     * Time spent in the listeners called by the listener being timed, which is left out of its own time
+     */
+    inline std::uint64_t nested_listener_time = 0;
+
+    /**
+     * Get the profile of the listeners of an event added from a module.
+     * Profiles are never freed, so listeners can keep a pointer to them.
+     * @param event_type    Type of the event
+     * @param module        Module the listener was added from
+     */
+    ListenerProfile *get_listener_profile(const std::type_info &event_type, HMODULE module);
+
+    /**
+     * Get the profile of the listeners of an event added from a Lua plugin.
+     * Lua listeners are called from subscriptions of Balltze itself, so they are profiled by plugin instead.
+     * @param event_type    Type of the event
+     * @param plugin_name   Name of the Lua plugin
+     */
+    ListenerProfile *get_lua_listener_profile(const std::type_info &event_type, const std::string &plugin_name);
+
+    /**
+     * Add a call to a listener profile
+     * @param profile   Profile of the listener
+     * @param time      Duration of the call, in nanoseconds
+     */
+    void record_listener_call(ListenerProfile *profile, std::uint64_t time) noexcept;
+
+    /**
+     * Call a function and add its time to a profile, minus the time of the listeners it called
+     * @param profile   Profile of the listener
+     * @param function  Function calling the listener
+     */
+    template<typename Function>
+    inline void time_listener_call(ListenerProfile *profile, Function &&function) {
+        auto outer_nested_time = nested_listener_time;
+        nested_listener_time = 0;
+        auto start = std::chrono::steady_clock::now();
+        function();
+        auto time = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        record_listener_call(profile, time - std::min(time, nested_listener_time));
+        nested_listener_time = outer_nested_time + time;
+    }
+
+    /**
+     * Call a listener, timing it if profiling is enabled
+     */
+    template<typename T>
+    inline void call_listener(ProfiledListener<T> &listener, T &event) {
+        if(!listener_profiling_enabled) {
+            listener.callback(event);
+            return;
+        }
+        time_listener_call(listener.profile, [&]() {
+            listener.callback(event);
+        });
+    }
+
+    /**
+     * Set up the listener profiler commands.
+     */
+    void set_up_listener_profiler();
+}
+
+#endif
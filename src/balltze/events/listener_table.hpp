@@ -0,0 +1,281 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__EVENTS__LISTENER_TABLE_HPP
+#define BALLTZE__EVENTS__LISTENER_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Balltze::Events {
+    /**
+     * Listeners of an event, grouped by priority.
+     * Every priority has its own contiguous array, and dispatching walks them from the highest priority to
+     * the lowest one. Handles index a slot map, so removing a listener is O(1): the listener is flagged and
+     * the arrays are compacted once the dispatch ends. Listeners added during a dispatch are called from the
+     * next one on. Both the Events API and the legacy event API keep their listeners in these tables.
+     * Handles never have the top bit of a 32-bit value set, so callers can tag handles of their own with it.
+     */
+    template<typename Callback, std::size_t priority_count = 4>
+    class ListenerTable {
+    private:
+        struct Listener {
+            /** Function to call */
+            Callback callback;
+
+            /** Slot of the listener's handle */
+            std::uint16_t slot;
+
+            /** Was the listener removed? */
+            bool removed;
+        };
+
+        struct Slot {
+            /** Bumped every time the slot is freed, so handles of removed listeners don't match; 15 bits, never zero, never reused */
+            std::uint16_t generation = 1;
+
+            /** Priority of the listener */
+            std::uint8_t priority = 0;
+
+            /** Is the listener waiting for the current dispatch to end? */
+            bool pending = false;
+
+            /** Is the slot in use? */
+            bool used = false;
+
+            /** Index of the listener in its array */
+            std::uint32_t index = 0;
+        };
+
+        /** Listeners by priority */
+        std::array<std::vector<Listener>, priority_count> m_listeners;
+
+        /** Listeners added during a dispatch */
+        std::vector<std::pair<std::size_t, Listener>> m_pending_listeners;
+
+        /** Handle slots */
+        std::vector<Slot> m_slots;
+
+        /** Slots that can be reused */
+        std::vector<std::uint16_t> m_free_slots;
+
+        /** Priorities with removed listeners */
+        std::array<bool, priority_count> m_removed_listeners = {};
+
+        /** Number of listeners, pending ones included */
+        std::size_t m_count = 0;
+
+        /** Number of nested dispatches running */
+        std::size_t m_dispatch_depth = 0;
+
+        static std::size_t make_handle(std::uint16_t slot, std::uint16_t generation) noexcept {
+            return (static_cast<std::size_t>(generation) << 16) | slot;
+        }
+
+        Slot *find_slot(std::size_t handle) noexcept {
+            std::size_t slot = handle & 0xFFFF;
+            std::size_t generation = (handle >> 16) & 0xFFFF;
+            if(slot >= m_slots.size() || !m_slots[slot].used || m_slots[slot].generation != generation) {
+                return nullptr;
+            }
+            return &m_slots[slot];
+        }
+
+        /**
+         * Drop removed listeners and add the ones that were added during the dispatch.
+         */
+        void compact() {
+            for(std::size_t priority = 0; priority < priority_count; priority++) {
+                if(!m_removed_listeners[priority]) {
+                    continue;
+                }
+                auto &listeners = m_listeners[priority];
+                std::size_t kept = 0;
+                for(std::size_t i = 0; i < listeners.size(); i++) {
+                    if(listeners[i].removed) {
+                        continue;
+                    }
+                    if(kept != i) {
+                        listeners[kept] = std::move(listeners[i]);
+                    }
+                    m_slots[listeners[kept].slot].index = kept;
+                    kept++;
+                }
+                listeners.erase(listeners.begin() + kept, listeners.end());
+                m_removed_listeners[priority] = false;
+            }
+
+            for(auto &[priority, listener] : m_pending_listeners) {
+                if(listener.removed) {
+                    continue;
+                }
+                auto &slot = m_slots[listener.slot];
+                slot.pending = false;
+                slot.index = m_listeners[priority].size();
+                m_listeners[priority].push_back(std::move(listener));
+            }
+            m_pending_listeners.clear();
+        }
+
+        template<typename Function>
+        void call_listeners(std::size_t priority, Function &call) {
+            auto &listeners = m_listeners[priority];
+            for(std::size_t i = 0; i < listeners.size(); i++) {
+                if(!listeners[i].removed) {
+                    call(listeners[i].callback);
+                }
+            }
+        }
+
+    public:
+        /**
+         * Keeps the table in a dispatch while it lives. Removed listeners are dropped before and after walking
+         * the arrays, even if a listener throws. Hold one on every table involved when interleaving several
+         * tables by priority, so listeners added by one priority's callbacks are not called by the lower ones.
+         */
+        class DispatchGuard {
+        private:
+            ListenerTable &m_table;
+
+        public:
+            DispatchGuard(ListenerTable &table) : m_table(table) {
+                if(m_table.m_dispatch_depth++ == 0) {
+                    m_table.compact();
+                }
+            }
+
+            ~DispatchGuard() {
+                if(--m_table.m_dispatch_depth == 0) {
+                    m_table.compact();
+                }
+            }
+
+            DispatchGuard(const DispatchGuard &) = delete;
+            DispatchGuard &operator=(const DispatchGuard &) = delete;
+        };
+
+        /**
+         * Add a listener
+         * @param callback  Function to call
+         * @param priority  Priority of the listener; higher priorities are called first
+         * @return          Handle of the listener
+         * @throws std::runtime_error if there are too many listeners
+         */
+        std::size_t add(Callback callback, std::size_t priority) {
+            if(priority >= priority_count) {
+                priority = priority_count - 1;
+            }
+
+            std::uint16_t slot_index;
+            if(!m_free_slots.empty()) {
+                slot_index = m_free_slots.back();
+                m_free_slots.pop_back();
+            }
+            else {
+                if(m_slots.size() > 0xFFFF) {
+                    throw std::runtime_error("Too many event listeners");
+                }
+                slot_index = static_cast<std::uint16_t>(m_slots.size());
+                m_slots.emplace_back();
+            }
+
+            auto &slot = m_slots[slot_index];
+            slot.used = true;
+            slot.priority = static_cast<std::uint8_t>(priority);
+            Listener listener = { std::move(callback), slot_index, false };
+            if(m_dispatch_depth > 0) {
+                slot.pending = true;
+                slot.index = m_pending_listeners.size();
+                m_pending_listeners.emplace_back(priority, std::move(listener));
+            }
+            else {
+                slot.pending = false;
+                slot.index = m_listeners[priority].size();
+                m_listeners[priority].push_back(std::move(listener));
+            }
+            m_count++;
+            return make_handle(slot_index, slot.generation);
+        }
+
+        /**
+         * Remove a listener
+         * @param handle    Handle returned by add
+         * @return          False if the handle does not belong to any listener
+         */
+        bool remove(std::size_t handle) {
+            auto *slot = find_slot(handle);
+            if(!slot) {
+                return false;
+            }
+
+            if(slot->pending) {
+                m_pending_listeners[slot->index].second.removed = true;
+            }
+            else {
+                m_listeners[slot->priority][slot->index].removed = true;
+                m_removed_listeners[slot->priority] = true;
+            }
+
+            // A slot whose generation would wrap is retired, so a stale copy of an old handle can never match a new listener
+            slot->used = false;
+            if(++slot->generation < 0x8000) {
+                m_free_slots.push_back(static_cast<std::uint16_t>(slot - m_slots.data()));
+            }
+            m_count--;
+            return true;
+        }
+
+        /**
+         * Call every listener, from the highest priority to the lowest one
+         * @param call  Function that receives the callback of each listener
+         */
+        template<typename Function>
+        void dispatch(Function &&call) {
+            DispatchGuard guard(*this);
+            for(std::size_t priority = priority_count; priority-- > 0;) {
+                call_listeners(priority, call);
+            }
+        }
+
+        /**
+         * Call the listeners of a single priority; used to interleave several tables by priority while holding
+         * a DispatchGuard on each of them
+         * @param priority  Priority of the listeners to call
+         * @param call      Function that receives the callback of each listener
+         */
+        template<typename Function>
+        void dispatch(std::size_t priority, Function &&call) {
+            if(priority >= priority_count) {
+                return;
+            }
+            DispatchGuard guard(*this);
+            call_listeners(priority, call);
+        }
+
+        /**
+         * Get the number of listeners
+         */
+        std::size_t size() const noexcept {
+            return m_count;
+        }
+
+        /**
+         * Check if there are no listeners
+         */
+        bool empty() const noexcept {
+            return m_count == 0;
+        }
+
+        /**
+         * Check if a dispatch is running on the table
+         */
+        bool dispatching() const noexcept {
+            return m_dispatch_depth > 0;
+        }
+    };
+}
+
+#endif
@@ -2,9 +2,13 @@
 
 #include <balltze/events/map.hpp>
 #include <balltze/legacy_api/events/map_load.hpp>
+#include "dispatch.hpp"
 
 namespace Balltze::Events {
     void dispatch_map_load_event(const char *map_name) {
+        if(!EventHandler<MapLoadEvent>::has_listeners()) {
+            return;
+        }
         MapLoadEvent event(map_name);
         event.dispatch();
     }
@@ -20,14 +24,14 @@ namespace Balltze::Events {
         }
         m_initialized = true;
 
-        LegacyApi::Event::MapLoadEvent::subscribe([](LegacyApi::Event::MapLoadEvent &event) {
-            if(event.time == LegacyApi::Event::EVENT_TIME_BEFORE) {
-                dispatch_map_load_event(event.context.name.c_str());
-            }
-        });
+        // The legacy map load hook dispatches this event after its own listeners
+        LegacyApi::Event::EventHandler<LegacyApi::Event::MapLoadEvent>::init();
     }
 
     void dispatch_map_loaded_event(const char *map_name) {
+        if(!EventHandler<MapLoadedEvent>::has_listeners()) {
+            return;
+        }
         MapLoadedEvent event(map_name);
         event.dispatch();
     }
@@ -43,10 +47,7 @@ namespace Balltze::Events {
         }
         m_initialized = true;
 
-        LegacyApi::Event::MapLoadEvent::subscribe([](auto &event) {
-            if(event.time == LegacyApi::Event::EVENT_TIME_AFTER) {
-                dispatch_map_loaded_event(event.context.name.c_str());
-            }
-        });
+        // The legacy map load hook dispatches this event after its own listeners
+        LegacyApi::Event::EventHandler<LegacyApi::Event::MapLoadEvent>::init();
     }
 }
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__EVENTS__MPSC_QUEUE_HPP
+#define BALLTZE__EVENTS__MPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace Balltze::Events {
+    /**
+     * Unbounded multiple producer, single consumer queue.
+     * Pushing is a single atomic exchange, so producers never wait for each other or for the consumer.
+     * Only one thread may pop. A pop can miss an item whose push is still halfway through; it is popped
+     * on the next try.
+     */
+    template<typename T>
+    class MpscQueue {
+    private:
+        struct Node {
+            std::atomic<Node *> next = nullptr;
+            std::optional<T> value;
+        };
+
+        /** Last pushed node; producers swap it */
+        std::atomic<Node *> m_head;
+
+        /** Node before the next one to pop; only touched by the consumer */
+        Node *m_tail;
+
+        /** Number of pushed items that were not popped yet */
+        std::atomic<std::size_t> m_size = 0;
+
+    public:
+        MpscQueue() {
+            auto *stub = new Node();
+            m_head.store(stub, std::memory_order_relaxed);
+            m_tail = stub;
+        }
+
+        MpscQueue(const MpscQueue &) = delete;
+        MpscQueue &operator=(const MpscQueue &) = delete;
+
+        ~MpscQueue() {
+            while(m_tail) {
+                auto *next = m_tail->next.load(std::memory_order_relaxed);
+                delete m_tail;
+                m_tail = next;
+            }
+        }
+
+        /**
+         * Add an item; safe to call from any thread
+         */
+        void push(T value) {
+            auto *node = new Node();
+            node->value.emplace(std::move(value));
+            m_size.fetch_add(1, std::memory_order_relaxed);
+            auto *previous = m_head.exchange(node, std::memory_order_acq_rel);
+            previous->next.store(node, std::memory_order_release);
+        }
+
+        /**
+         * Take the oldest item; only call from the consumer thread
+         * @return  The item, or nothing if the queue is empty
+         */
+        std::optional<T> pop() {
+            auto *next = m_tail->next.load(std::memory_order_acquire);
+            if(!next) {
+                return std::nullopt;
+            }
+            std::optional<T> value = std::move(next->value);
+            next->value.reset();
+            delete m_tail;
+            m_tail = next;
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+            return value;
+        }
+
+        /**
+         * Get the number of items waiting; only a hint while producers are pushing
+         */
+        std::size_t size() const noexcept {
+            return m_size.load(std::memory_order_relaxed);
+        }
+    };
+}
+
+#endif
@@ -2,9 +2,15 @@
 
 #include <balltze/events/tick.hpp>
 #include <balltze/legacy_api/events/tick.hpp>
+#include "deferred.hpp"
+#include "dispatch.hpp"
 
 namespace Balltze::Events {
     void dispatch_tick_event() {
+        run_deferred_tasks(DEFERRED_TASK_TICK);
+        if(!EventHandler<TickEvent>::has_listeners()) {
+            return;
+        }
         TickEvent event;
         event.dispatch();
     }
@@ -16,10 +22,7 @@ namespace Balltze::Events {
         }
         m_initialized = true;
 
-        LegacyApi::Event::TickEvent::subscribe([](auto &event) {
-            if(event.time == LegacyApi::Event::EVENT_TIME_AFTER) {
-                dispatch_tick_event();
-            }
-        });
+        // The legacy tick hook dispatches this event after its own listeners
+        LegacyApi::Event::EventHandler<LegacyApi::Event::TickEvent>::init();
     }
 }
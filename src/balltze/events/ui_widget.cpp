@@ -11,6 +11,9 @@ namespace Balltze::Events {
         void ui_widget_event_handler_dispatch_hook();
         
         bool dispatch_widget_event(Widget *widget, UIWidgetDefinition *widget_definition, UIWidgetEventRecord *event_record, EventHandlerReference *event_handler, int16_t *controller_index) {
+            if(!EventHandler<WidgetEventDispatchEvent>::has_listeners()) {
+                return false;
+            }
             WidgetEventDispatchEvent event(widget, event_record, event_handler);
             event.dispatch();
             return event.cancelled();
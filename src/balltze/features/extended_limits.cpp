@@ -4,6 +4,7 @@
 #include <balltze/hook.hpp>
 #include "../config/config.hpp"
 #include "../logger.hpp"
+#include "../memory/memory.hpp"
 
 namespace Balltze::Features {
     extern "C" {
@@ -16,10 +17,10 @@ namespace Balltze::Features {
     }
 
     static void extend_region_permutation_limit() {
-        auto *reserve_local_vars_space_sig = Memory::get_signature("read_region_permutation_function_reserve_local_vars_space");
-        auto *free_local_vars_space_sig = Memory::get_signature("read_region_permutation_function_free_local_vars_space");
-        auto *param_1_read_1_sig = Memory::get_signature("read_region_permutation_function_param_1_read_1");
-        auto *param_1_read_2_sig = Memory::get_signature("read_region_permutation_function_param_1_read_2");
+        auto *reserve_local_vars_space_sig = Memory::get_signature(Memory::SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_RESERVE_LOCAL_VARS_SPACE);
+        auto *free_local_vars_space_sig = Memory::get_signature(Memory::SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_FREE_LOCAL_VARS_SPACE);
+        auto *param_1_read_1_sig = Memory::get_signature(Memory::SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_PARAM_1_READ_1);
+        auto *param_1_read_2_sig = Memory::get_signature(Memory::SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_PARAM_1_READ_2);
         if(!reserve_local_vars_space_sig || !free_local_vars_space_sig || !param_1_read_1_sig || !param_1_read_2_sig) {
             logger.error("Failed to find signatures for expanding region permutation limit");
             return;
@@ -25,6 +25,7 @@
 #include "../../output/video.hpp"
 #include "../../logger.hpp"
 #include "../../resources.hpp"
+#include "../../memory/memory.hpp"
 
 using namespace std::chrono_literals;
 
@@ -239,8 +240,8 @@ namespace Balltze::Features {
         LegacyApi::Event::D3D9EndSceneEvent::subscribe(update_d3d9_device, LegacyApi::Event::EVENT_PRIORITY_HIGHEST);
         LegacyApi::Event::D3D9DeviceResetEvent::subscribe(on_device_reset, LegacyApi::Event::EVENT_PRIORITY_HIGHEST);
 
-        auto behavior_flags_sig = Memory::get_signature("d3d9_device_behavior_flags");
-        auto load_map_function_sig = Memory::get_signature("load_map_function");
+        auto behavior_flags_sig = Memory::get_signature(Memory::SIGNATURE_D3D9_DEVICE_BEHAVIOR_FLAGS);
+        auto load_map_function_sig = Memory::get_signature(Memory::SIGNATURE_LOAD_MAP_FUNCTION);
         if(!behavior_flags_sig || !load_map_function_sig) {
             logger.error("Failed to find signatures for loading screen.");
             return;
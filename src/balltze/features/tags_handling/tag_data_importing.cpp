@@ -21,6 +21,7 @@
 #include "../../logger.hpp"
 #include "map.hpp"
 #include "tags_handling.hpp"
+#include "../../memory/memory.hpp"
 
 namespace Balltze::Features {
     namespace fs = std::filesystem;
@@ -921,10 +922,10 @@ namespace Balltze::Features {
         LegacyApi::Event::MapFileLoadEvent::subscribe(on_map_file_load);
         LegacyApi::Event::MapFileDataReadEvent::subscribe(on_read_map_file_data);
 
-        auto *model_data_buffer_alloc_sig = Memory::get_signature("model_data_buffer_alloc");
+        auto *model_data_buffer_alloc_sig = Memory::get_signature(Memory::SIGNATURE_MODEL_DATA_BUFFER_ALLOC);
         auto *model_data_buffer_alloc_hook = Memory::hook_function(model_data_buffer_alloc_sig->data(), on_model_data_buffer_alloc_asm);
 
-        auto *tag_data_read_done_sig = Memory::get_signature("tag_data_read_done");
+        auto *tag_data_read_done_sig = Memory::get_signature(Memory::SIGNATURE_TAG_DATA_READ_DONE);
         Memory::hook_function(tag_data_read_done_sig->data(), import_tag_data);
 
         CommandBuilder()
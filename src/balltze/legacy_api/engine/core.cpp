@@ -9,6 +9,7 @@
 #include <balltze/legacy_api/engine/core.hpp>
 #include "../../config/config.hpp"
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
 
 namespace Balltze::LegacyApi::Engine {
     extern "C" {
@@ -60,7 +61,7 @@ namespace Balltze::LegacyApi::Engine {
 
     std::size_t get_tick_count() noexcept {
         static std::int32_t *tick_count = nullptr;
-        static auto *tick_count_sig = Memory::get_signature("tick_counter");
+        static auto *tick_count_sig = Memory::get_signature(Memory::SIGNATURE_TICK_COUNTER);
         if(!tick_count) {
             tick_count = reinterpret_cast<std::int32_t *>(**reinterpret_cast<std::byte ***>(tick_count_sig->data()) + 0xC);
         }
@@ -69,7 +70,7 @@ namespace Balltze::LegacyApi::Engine {
 
     float get_tick_rate() noexcept {
         static float *tick_ptr = nullptr;
-        static auto *tick_rate_sig = Memory::get_signature("tick_rate");
+        static auto *tick_rate_sig = Memory::get_signature(Memory::SIGNATURE_TICK_RATE);
         if(tick_rate_sig) {
             tick_ptr = *reinterpret_cast<float **>(tick_rate_sig->data());
         }
@@ -79,7 +80,7 @@ namespace Balltze::LegacyApi::Engine {
     EngineEdition get_engine_edition() {
         static std::optional<EngineEdition> engine_type;
         if(!engine_type.has_value()) {
-            auto *engine_edition_sig = Memory::get_signature("engine_type");
+            auto *engine_edition_sig = Memory::get_signature(Memory::SIGNATURE_ENGINE_TYPE);
             if(!engine_edition_sig) {
                 throw std::runtime_error("engine_edition signature not found");
             }
@@ -7,6 +7,7 @@
 #include <balltze/legacy_api/engine/game_state.hpp>
 #include <balltze/memory.hpp>
 #include <impl/unit/unit.h>
+#include "../../memory/memory.hpp"
 
 namespace Balltze::LegacyApi::Engine {
     BaseObject *ObjectTable::get_object(const ObjectHandle &object_handle) noexcept {
@@ -79,7 +80,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     ObjectTable &get_object_table() noexcept {
-        static auto &object_table = ***reinterpret_cast<ObjectTable ***>(Memory::get_signature("object_table_address")->data());
+        static auto &object_table = ***reinterpret_cast<ObjectTable ***>(Memory::get_signature(Memory::SIGNATURE_OBJECT_TABLE_ADDRESS)->data());
         return object_table;
     }
 
@@ -102,7 +103,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     PlayerHandle get_client_player_handle() noexcept {
-        static PlayerHandle *player_handle = reinterpret_cast<PlayerHandle *>(**reinterpret_cast<std::byte ***>(Memory::get_signature("player_handle_address")->data()) + 4);
+        static PlayerHandle *player_handle = reinterpret_cast<PlayerHandle *>(**reinterpret_cast<std::byte ***>(Memory::get_signature(Memory::SIGNATURE_PLAYER_HANDLE_ADDRESS)->data()) + 4);
         return *player_handle;
     }
 
@@ -146,58 +147,58 @@ namespace Balltze::LegacyApi::Engine {
     PlayerTable &get_player_table() noexcept {
         static PlayerTable *table = nullptr;
         if(!table) {
-            table = *reinterpret_cast<PlayerTable **>(*reinterpret_cast<std::byte **>(Memory::get_signature("player_table_address")->data()));
+            table = *reinterpret_cast<PlayerTable **>(*reinterpret_cast<std::byte **>(Memory::get_signature(Memory::SIGNATURE_PLAYER_TABLE_ADDRESS)->data()));
         }
         return *table;
     }
 
     AntennaTable &get_antenna_table() noexcept {
-        static auto *antenna_table = **reinterpret_cast<AntennaTable ***>(Memory::get_signature("antenna_table_address")->data());
+        static auto *antenna_table = **reinterpret_cast<AntennaTable ***>(Memory::get_signature(Memory::SIGNATURE_ANTENNA_TABLE_ADDRESS)->data());
         return *antenna_table;
     }
 
     DecalTable &get_decal_table() noexcept {
-        static auto *decal_table = **reinterpret_cast<DecalTable ***>(Memory::get_signature("decal_table_address")->data());
+        static auto *decal_table = **reinterpret_cast<DecalTable ***>(Memory::get_signature(Memory::SIGNATURE_DECAL_TABLE_ADDRESS)->data());
         return *decal_table;
     }
 
     EffectTable &get_effect_table() noexcept {
-        static auto *effect_table = **reinterpret_cast<EffectTable ***>(Memory::get_signature("effect_table_address")->data());
+        static auto *effect_table = **reinterpret_cast<EffectTable ***>(Memory::get_signature(Memory::SIGNATURE_EFFECT_TABLE_ADDRESS)->data());
         return *effect_table;
     }
 
     FlagTable &get_flag_table() noexcept {
-        static auto *flag_table = **reinterpret_cast<FlagTable ***>(Memory::get_signature("flag_table_address")->data());
+        static auto *flag_table = **reinterpret_cast<FlagTable ***>(Memory::get_signature(Memory::SIGNATURE_FLAG_TABLE_ADDRESS)->data());
         return *flag_table;
     }
 
     LightTable &get_light_table() noexcept {
-        static auto *light_table = **reinterpret_cast<LightTable ***>(Memory::get_signature("light_table_address")->data());
+        static auto *light_table = **reinterpret_cast<LightTable ***>(Memory::get_signature(Memory::SIGNATURE_LIGHT_TABLE_ADDRESS)->data());
         return *light_table;
     }
 
     ParticleTable &get_particle_table() noexcept {
-        static auto *particle_table = **reinterpret_cast<ParticleTable ***>(Memory::get_signature("particle_table_address")->data());
+        static auto *particle_table = **reinterpret_cast<ParticleTable ***>(Memory::get_signature(Memory::SIGNATURE_PARTICLE_TABLE_ADDRESS)->data());
         return *particle_table;
     }
 
     bool game_paused() noexcept {
         static std::optional<std::byte **> paused_addr;
         if(!paused_addr.has_value()) {
-            paused_addr = *reinterpret_cast<std::byte ***>(Memory::get_signature("game_paused_flag_address")->data());
+            paused_addr = *reinterpret_cast<std::byte ***>(Memory::get_signature(Memory::SIGNATURE_GAME_PAUSED_FLAG_ADDRESS)->data());
         }
         return *reinterpret_cast<bool *>(*paused_addr.value() + 2);
     }
 
     CameraType get_camera_type() noexcept {
-        static auto *cta = reinterpret_cast<CameraType *>(*reinterpret_cast<std::byte **>(Memory::get_signature("camera_type")->data()) + 0x56);
+        static auto *cta = reinterpret_cast<CameraType *>(*reinterpret_cast<std::byte **>(Memory::get_signature(Memory::SIGNATURE_CAMERA_TYPE)->data()) + 0x56);
         return *cta;
     }
 
     CameraData &get_camera_data() noexcept {
         static std::optional<CameraData *> camera_coord_addr;
         if(!camera_coord_addr.has_value()) {
-            camera_coord_addr = reinterpret_cast<CameraData *>(*reinterpret_cast<std::byte **>(Memory::get_signature("camera_coord")->data()) - 0x8);
+            camera_coord_addr = reinterpret_cast<CameraData *>(*reinterpret_cast<std::byte **>(Memory::get_signature(Memory::SIGNATURE_CAMERA_COORD)->data()) - 0x8);
         }
         return **camera_coord_addr;
     }
@@ -6,16 +6,17 @@
 #include <balltze/legacy_api/engine/map.hpp>
 #include <balltze/legacy_api/engine/tag.hpp>
 #include <balltze/memory.hpp>
+#include "../../memory/memory.hpp"
 
 namespace Balltze::LegacyApi::Engine {
     MapHeader &get_map_header() noexcept {
-        static auto *map_header_sig = Memory::get_signature("map_header");
+        static auto *map_header_sig = Memory::get_signature(Memory::SIGNATURE_MAP_HEADER);
         static auto *map_header = *reinterpret_cast<MapHeader **>(map_header_sig->data());
         return *map_header;
     }
 
     MapHeaderDemo &get_demo_map_header() noexcept {
-        static auto *map_header_sig = Memory::get_signature("map_header");
+        static auto *map_header_sig = Memory::get_signature(Memory::SIGNATURE_MAP_HEADER);
         static auto *map_header = reinterpret_cast<MapHeaderDemo *>(map_header_sig->data()) - 0x2C0;
         return *map_header;
     }
@@ -23,7 +24,7 @@ namespace Balltze::LegacyApi::Engine {
     MapList &get_map_list() noexcept {
         static std::optional<MapList *> all_map_indices;
         if(!all_map_indices.has_value()) {
-            static auto *map_list_sig = Memory::get_signature("map_index");
+            static auto *map_list_sig = Memory::get_signature(Memory::SIGNATURE_MAP_INDEX);
             all_map_indices = *reinterpret_cast<MapList **>(map_list_sig->data());
         }
         return **all_map_indices;
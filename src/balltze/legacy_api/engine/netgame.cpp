@@ -4,6 +4,7 @@
 #include <balltze/legacy_api/engine/game_state.hpp>
 #include <balltze/legacy_api/engine/netgame.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
 
 namespace Balltze::LegacyApi::Engine {
     extern "C" {
@@ -31,17 +32,17 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     NetworkGameServerType network_game_get_server_type() {
-        static auto *server_type = *reinterpret_cast<NetworkGameServerType **>(Memory::get_signature("server_type")->data() + 3);
+        static auto *server_type = *reinterpret_cast<NetworkGameServerType **>(Memory::get_signature(Memory::SIGNATURE_SERVER_TYPE)->data() + 3);
         return *server_type;
     }
 
     NetworkGameType network_game_get_current_game_type() {
-        static auto *gametype = *reinterpret_cast<NetworkGameType **>(Memory::get_signature("current_gametype")->data() + 2);
+        static auto *gametype = *reinterpret_cast<NetworkGameType **>(Memory::get_signature(Memory::SIGNATURE_CURRENT_GAMETYPE)->data() + 2);
         return *gametype;
     }
 
     bool network_game_current_game_is_team() {
-        static auto *is_team = *reinterpret_cast<std::uint8_t **>(Memory::get_signature("current_gametype")->data() + 2) + 4;
+        static auto *is_team = *reinterpret_cast<std::uint8_t **>(Memory::get_signature(Memory::SIGNATURE_CURRENT_GAMETYPE)->data() + 2) + 4;
         return *is_team;
     }
 
@@ -104,7 +105,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     bool network_game_is_client() {
-        static auto *network_data_sig = Memory::get_signature("network_game_data_pointer");
+        static auto *network_data_sig = Memory::get_signature(Memory::SIGNATURE_NETWORK_GAME_DATA_POINTER);
         if(!network_data_sig) {
             return false;
         }
@@ -117,7 +118,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     bool network_game_is_server() {
-        static auto *network_data_sig = Memory::get_signature("network_game_data_pointer");
+        static auto *network_data_sig = Memory::get_signature(Memory::SIGNATURE_NETWORK_GAME_DATA_POINTER);
         if(!network_data_sig) {
             return false;
         }
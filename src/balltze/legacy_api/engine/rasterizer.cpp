@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <balltze/legacy_api/engine/rasterizer.hpp>
+#include "../../memory/memory.hpp"
 
 namespace Balltze::LegacyApi::Engine {
     extern "C" {
@@ -20,7 +21,7 @@ namespace Balltze::LegacyApi::Engine {
     WindowGlobals *get_window_globals() {
         static std::optional<WindowGlobals *> window_globals;
         if(!window_globals.has_value()) {
-            auto *window_globals_sig = Memory::get_signature("window_globals");
+            auto *window_globals_sig = Memory::get_signature(Memory::SIGNATURE_WINDOW_GLOBALS);
             if(!window_globals_sig) {
                 throw std::runtime_error("window_globals signature not found");
             }
@@ -30,13 +31,13 @@ namespace Balltze::LegacyApi::Engine {
     }
     
     Resolution &get_resolution() noexcept {
-        static auto *resolution_sig = Memory::get_signature("resolution");
+        static auto *resolution_sig = Memory::get_signature(Memory::SIGNATURE_RESOLUTION);
         static Resolution *resolution = *reinterpret_cast<Resolution **>(resolution_sig->data());
         return *resolution;
     }
 
     IDirect3DDevice9 *get_d3d9_device() noexcept {
-        static auto *device_sig = Memory::get_signature("d3d9_device_pointer");
+        static auto *device_sig = Memory::get_signature(Memory::SIGNATURE_D3D9_DEVICE_POINTER);
         static IDirect3DDevice9 **device = *reinterpret_cast<IDirect3DDevice9 ***>(device_sig->data());
         return *device;
     }
@@ -46,7 +47,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     VertexShader *get_vertex_shader(std::size_t index) {
-        static auto *rasterizer_vertex_shaders_table_address_sig = Memory::get_signature("rasterizer_vertex_shaders_table_address");
+        static auto *rasterizer_vertex_shaders_table_address_sig = Memory::get_signature(Memory::SIGNATURE_RASTERIZER_VERTEX_SHADERS_TABLE_ADDRESS);
         if(!rasterizer_vertex_shaders_table_address_sig) {
             throw std::runtime_error("Could not find signature for rasterizer vertex shaders table address");
         }
@@ -58,7 +59,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     VertexShader *get_vertex_shader(std::string name) {
-        static auto *rasterizer_vertex_shaders_table_address_sig = Memory::get_signature("rasterizer_vertex_shaders_table_address");
+        static auto *rasterizer_vertex_shaders_table_address_sig = Memory::get_signature(Memory::SIGNATURE_RASTERIZER_VERTEX_SHADERS_TABLE_ADDRESS);
         if(!rasterizer_vertex_shaders_table_address_sig) {
             throw std::runtime_error("Could not find signature for rasterizer vertex shaders table address");
         }
@@ -72,7 +73,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     VertexShader *get_vertex_shader_index_for_permutation(std::size_t vertex_type, std::size_t permutation_index) {
-        static auto *rasterizer_vertex_shaders_permutations_table_address_sig = Memory::get_signature("rasterizer_vertex_shaders_permutations_table_address");
+        static auto *rasterizer_vertex_shaders_permutations_table_address_sig = Memory::get_signature(Memory::SIGNATURE_RASTERIZER_VERTEX_SHADERS_PERMUTATIONS_TABLE_ADDRESS);
         if(!rasterizer_vertex_shaders_permutations_table_address_sig) {
             throw std::runtime_error("Could not find signature for rasterizer vertex shaders permutations table address");
         }
@@ -81,7 +82,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     VertexDeclaration *get_vertex_declaration(std::size_t index) {
-        static auto *rasterizer_vertex_declarations_table_address_sig = Memory::get_signature("rasterizer_vertex_declarations_table_address");
+        static auto *rasterizer_vertex_declarations_table_address_sig = Memory::get_signature(Memory::SIGNATURE_RASTERIZER_VERTEX_DECLARATIONS_TABLE_ADDRESS);
         if(!rasterizer_vertex_declarations_table_address_sig) {
             throw std::runtime_error("Could not find signature for rasterizer vertex declarations table address");
         }
@@ -94,7 +95,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     IDirect3DTexture9 *load_bitmap_data_texture(TagDefinitions::BitmapData *bitmap_data, bool immediate, bool force_pixels_read) {
-        static auto *load_bitmap_sig = Memory::get_signature("load_bitmap_function");
+        static auto *load_bitmap_sig = Memory::get_signature(Memory::SIGNATURE_LOAD_BITMAP_FUNCTION);
         if(!load_bitmap_sig) {
             throw std::runtime_error("Could not find signature for bitmap load function");
         }
@@ -129,7 +130,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     RenderTarget *get_render_target(std::size_t index) {
-        static auto *render_targets_sig = Memory::get_signature("d3d9_render_targets");
+        static auto *render_targets_sig = Memory::get_signature(Memory::SIGNATURE_D3D9_RENDER_TARGETS);
         if(!render_targets_sig) {
             throw std::runtime_error("Could not find signature for render targets");
         }
@@ -140,7 +141,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     std::int16_t get_transparent_geometry_group_vertex_type(TransparentGeometryGroup *group) {
-        static auto *sig = Memory::get_signature("rasterizer_vertices_types_table_address");
+        static auto *sig = Memory::get_signature(Memory::SIGNATURE_RASTERIZER_VERTICES_TYPES_TABLE_ADDRESS);
         if(!sig) {
             throw std::runtime_error("Could not find signature for rasterizer vertices types table address");
         }
@@ -178,7 +179,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     void *get_frame_paramaters() {
-        static auto *frame_parameters_sig = Memory::get_signature("rasterizer_frame_parameters_address");
+        static auto *frame_parameters_sig = Memory::get_signature(Memory::SIGNATURE_RASTERIZER_FRAME_PARAMETERS_ADDRESS);
         if(!frame_parameters_sig) {
             throw std::runtime_error("Could not find signature for frame parameters");
         }
@@ -191,7 +192,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     void render_user_interface_widgets(std::uint16_t player_index) {
-        static auto *render_user_interface_function_sig = Memory::get_signature("render_user_interface_function");
+        static auto *render_user_interface_function_sig = Memory::get_signature(Memory::SIGNATURE_RENDER_USER_INTERFACE_FUNCTION);
         if(!render_user_interface_function_sig) {
             throw std::runtime_error("Could not find signature for UI render function");
         }
@@ -202,7 +203,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     void render_player_hud() {
-        static auto *render_hud_function_sig = Memory::get_signature("render_hud_function");
+        static auto *render_hud_function_sig = Memory::get_signature(Memory::SIGNATURE_RENDER_HUD_FUNCTION);
         if(!render_hud_function_sig) {
             throw std::runtime_error("Could not find signature for HUD render function");
         }
@@ -211,7 +212,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     void render_netgame_post_carnage_report() {
-        static auto *render_post_carnage_report_function_sig = Memory::get_signature("render_post_carnage_report_function");
+        static auto *render_post_carnage_report_function_sig = Memory::get_signature(Memory::SIGNATURE_RENDER_POST_CARNAGE_REPORT_FUNCTION);
         if(!render_post_carnage_report_function_sig) {
             throw std::runtime_error("Could not find signature for post carnage report render function");
         }
@@ -9,22 +9,23 @@
 #include <balltze/legacy_api/engine/tag_definitions/ui_widget_definition.hpp>
 #include <balltze/legacy_api/engine/user_interface.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
 
 namespace Balltze::LegacyApi::Engine {
     WidgetEventGlobals *get_widget_event_globals() {
-        static auto *widget_event_globals_sig = Memory::get_signature("widget_event_globals");
+        static auto *widget_event_globals_sig = Memory::get_signature(Memory::SIGNATURE_WIDGET_EVENT_GLOBALS);
         static auto *widget_event_globals = *reinterpret_cast<WidgetEventGlobals **>(widget_event_globals_sig->data());
         return widget_event_globals;
     }
     
     WidgetCursorGlobals *get_widget_cursor_globals() {
-        static auto *cursor_globals_sig = Memory::get_signature("widget_cursor_globals");
+        static auto *cursor_globals_sig = Memory::get_signature(Memory::SIGNATURE_WIDGET_CURSOR_GLOBALS);
         static auto *widget_cursor_globals = *reinterpret_cast<WidgetCursorGlobals **>(cursor_globals_sig->data());
         return widget_cursor_globals;
     }
     
     WidgetGlobals *get_widget_globals() {
-        static auto *widget_globals_sig = Memory::get_signature("widget_globals");
+        static auto *widget_globals_sig = Memory::get_signature(Memory::SIGNATURE_WIDGET_GLOBALS);
         static auto *widget_globals = *reinterpret_cast<WidgetGlobals **>(widget_globals_sig->data());
         return widget_globals;
     }
@@ -291,11 +292,11 @@ namespace Balltze::LegacyApi::Engine {
         auto server_type = network_game_get_server_type();
         const char *tag_path = nullptr;
         if(server_type == NETWORK_GAME_SERVER_NONE) {
-            auto *singleplayer_pause_menu_tag_path_sig = Memory::get_signature("singleplayer_pause_menu_tag_path");
+            auto *singleplayer_pause_menu_tag_path_sig = Memory::get_signature(Memory::SIGNATURE_SINGLEPLAYER_PAUSE_MENU_TAG_PATH);
             tag_path = *reinterpret_cast<const char **>(singleplayer_pause_menu_tag_path_sig->data());
         }
         else {
-            auto *multiplayer_pause_menu_tag_path_sig = Memory::get_signature("multiplayer_pause_menu_tag_path");
+            auto *multiplayer_pause_menu_tag_path_sig = Memory::get_signature(Memory::SIGNATURE_MULTIPLAYER_PAUSE_MENU_TAG_PATH);
             tag_path = *reinterpret_cast<const char **>(multiplayer_pause_menu_tag_path_sig->data());
         }
         if(tag_path) {
@@ -307,7 +308,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     HudGlobals &get_hud_globals() {
-        static auto *sig = Memory::get_signature("hud_icon_messages_tag_handle");
+        static auto *sig = Memory::get_signature(Memory::SIGNATURE_HUD_ICON_MESSAGES_TAG_HANDLE);
         if(!sig) {
             throw std::runtime_error("Could not find signature for hud icon messages tag handle");
         }
@@ -373,7 +374,7 @@ namespace Balltze::LegacyApi::Engine {
     }
 
     std::uint8_t get_master_volume() noexcept {
-        static auto *master_volume_sig = Memory::get_signature("master_volume");
+        static auto *master_volume_sig = Memory::get_signature(Memory::SIGNATURE_MASTER_VOLUME);
         static auto *master_volume = *reinterpret_cast<std::uint8_t **>(master_volume_sig->data()) + 0xB78;
         return *master_volume;
     }
@@ -465,7 +466,7 @@ namespace Balltze::LegacyApi::Engine {
     Controls &get_controls() noexcept {
         static std::optional<Controls *> controls_table;
         if(!controls_table.has_value()) {
-            controls_table = *reinterpret_cast<Controls **>(Memory::get_signature("controls_struct_address")->data());
+            controls_table = *reinterpret_cast<Controls **>(Memory::get_signature(Memory::SIGNATURE_CONTROLS_STRUCT_ADDRESS)->data());
         }
         return **controls_table;
     }
@@ -473,14 +474,14 @@ namespace Balltze::LegacyApi::Engine {
     bool *get_keyboard_keys() noexcept {
         static bool *buffer = nullptr;
         if(!buffer) {
-            buffer = *reinterpret_cast<bool **>(Memory::get_signature("keyboard_keys_struct_address")->data());
+            buffer = *reinterpret_cast<bool **>(Memory::get_signature(Memory::SIGNATURE_KEYBOARD_KEYS_STRUCT_ADDRESS)->data());
         }
         return buffer;
     }
 
     void set_console_key_binding(KeyboardKey key) {
         static KeyboardKey *console_key_binding = nullptr;
-        static auto *sig = Memory::get_signature("input_control_keys");
+        static auto *sig = Memory::get_signature(Memory::SIGNATURE_INPUT_CONTROL_KEYS);
         if(!sig) {
             throw std::runtime_error("Could not find signature for input control keys");
         }
@@ -5,15 +5,23 @@
 #include <balltze/command.hpp>
 #include <balltze/api.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     static void camera_event_before_dispatcher() {
+        if(!event_has_listeners<CameraEvent>) {
+            return;
+        }
         CameraEventContext context(&LegacyApi::Engine::get_camera_data(), LegacyApi::Engine::get_camera_type());
         CameraEvent camera_event(EVENT_TIME_BEFORE, context);
         camera_event.dispatch();
     }
 
     static void camera_event_after_dispatcher() {
+        if(!event_has_listeners<CameraEvent>) {
+            return;
+        }
         CameraEventContext context(&LegacyApi::Engine::get_camera_data(), LegacyApi::Engine::get_camera_type());
         CameraEvent camera_event(EVENT_TIME_AFTER, context);
         camera_event.dispatch();
@@ -31,7 +39,7 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *camera_data_read_sig = Memory::get_signature("camera_data_read");
+        auto *camera_data_read_sig = Memory::get_signature(Memory::SIGNATURE_CAMERA_DATA_READ);
         if(!camera_data_read_sig) {
             throw std::runtime_error("Could not find signature for camera event");
         }
@@ -39,7 +47,8 @@ namespace Balltze::LegacyApi::Event {
         try {
             // Workaround for Chimera hook (NEEDS TO BE FIXED)
             std::byte *ptr = Memory::follow_32bit_jump(camera_data_read_sig->data()) + 9;
-            auto *camera_data_read_chimera_hook = Memory::hook_function(ptr, camera_event_before_dispatcher, camera_event_after_dispatcher);
+            auto *camera_data_read_chimera_hook = Memory::hook_function(ptr, camera_event_before_dispatcher, camera_event_after_dispatcher, Memory::HOOK_REGISTERS_CDECL, true);
+            set_event_hooks<CameraEvent>({ camera_data_read_chimera_hook });
         }
         catch(const std::runtime_error &e) {
             throw std::runtime_error("Could not hook camera event: " + std::string(e.what()));
@@ -6,6 +6,7 @@
 #include <balltze/command.hpp>
 #include "../../logger.hpp"
 #include "console_command.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     extern "C" {
@@ -14,6 +15,9 @@ namespace Balltze::LegacyApi::Event {
         void *console_command_function = nullptr;
 
         bool dispatch_console_command_event_before(const char *command) {
+            if(!event_has_listeners<ConsoleCommandEvent>) {
+                return false;
+            }
             ConsoleCommandEventContext args(command);
             ConsoleCommandEvent console_command_event(EVENT_TIME_BEFORE, args);
             console_command_event.dispatch();
@@ -21,6 +25,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_console_command_event_after(const char *command) {
+            if(!event_has_listeners<ConsoleCommandEvent>) {
+                return;
+            }
             ConsoleCommandEventContext args(command);
             ConsoleCommandEvent console_command_event(EVENT_TIME_AFTER, args);
             console_command_event.dispatch();
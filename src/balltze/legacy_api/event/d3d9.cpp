@@ -8,6 +8,9 @@
 #include <balltze/hook.hpp>
 #include <balltze/utils.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "../../events/dispatch.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     extern "C" {
@@ -19,36 +22,54 @@ namespace Balltze::LegacyApi::Event {
         void d3d9_device_reset_after_event();
 
         void dispatch_d3d9_begin_scene_before_event(IDirect3DDevice9 *device) {
-            D3D9BeginSceneEventContext context(device);
-            D3D9BeginSceneEvent event(EVENT_TIME_BEFORE, context);
-            event.dispatch();
+            if(event_has_listeners<D3D9BeginSceneEvent>) {
+                D3D9BeginSceneEventContext context(device);
+                D3D9BeginSceneEvent event(EVENT_TIME_BEFORE, context);
+                event.dispatch();
+            }
+            Events::dispatch_frame_begin_event();
         }
 
         void dispatch_d3d9_begin_scene_after_event(IDirect3DDevice9 *device) {
+            if(!event_has_listeners<D3D9BeginSceneEvent>) {
+                return;
+            }
             D3D9BeginSceneEventContext context(device);
             D3D9BeginSceneEvent event(EVENT_TIME_AFTER, context);
             event.dispatch();
         }
 
         void dispatch_d3d9_end_scene_before_event(IDirect3DDevice9 *device) {
-            D3D9EndSceneEventContext context(device);
-            D3D9EndSceneEvent event(EVENT_TIME_BEFORE, context);
-            event.dispatch();
+            if(event_has_listeners<D3D9EndSceneEvent>) {
+                D3D9EndSceneEventContext context(device);
+                D3D9EndSceneEvent event(EVENT_TIME_BEFORE, context);
+                event.dispatch();
+            }
+            Events::dispatch_frame_end_event();
         }
 
         void dispatch_d3d9_end_scene_after_event(IDirect3DDevice9 *device) {
+            if(!event_has_listeners<D3D9EndSceneEvent>) {
+                return;
+            }
             D3D9EndSceneEventContext context(device);
             D3D9EndSceneEvent event(EVENT_TIME_AFTER, context);
             event.dispatch();
         }
 
         void dispatch_d3d9_device_reset_before_event(IDirect3DDevice9 *device, D3DPRESENT_PARAMETERS *params) {
+            if(!event_has_listeners<D3D9DeviceResetEvent>) {
+                return;
+            }
             D3D9DeviceResetEventContext context(device, params);
             D3D9DeviceResetEvent event(EVENT_TIME_BEFORE, context);
             event.dispatch();
         }
 
         void dispatch_d3d9_device_reset_after_event(IDirect3DDevice9 *device, D3DPRESENT_PARAMETERS *params) {
+            if(!event_has_listeners<D3D9DeviceResetEvent>) {
+                return;
+            }
             D3D9DeviceResetEventContext context(device, params);
             D3D9DeviceResetEvent event(EVENT_TIME_AFTER, context);
             event.dispatch();
@@ -67,7 +88,7 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *d3d9_begin_scene_sig = Memory::get_signature("d3d9_call_begin_scene");
+        auto *d3d9_begin_scene_sig = Memory::get_signature(Memory::SIGNATURE_D3D9_CALL_BEGIN_SCENE);
         if(!d3d9_begin_scene_sig) {
             throw std::runtime_error("Could not find signature for D3D9 begin scene event");
         }
@@ -92,7 +113,7 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *d3d9_end_scene_sig = Memory::get_signature("d3d9_call_end_scene");
+        auto *d3d9_end_scene_sig = Memory::get_signature(Memory::SIGNATURE_D3D9_CALL_END_SCENE);
         if(!d3d9_end_scene_sig) {
             throw std::runtime_error("Could not find signature for D3D9 end scene event");
         }
@@ -126,7 +147,7 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *d3d9_device_reset_sig = Memory::get_signature("d3d9_call_reset");
+        auto *d3d9_device_reset_sig = Memory::get_signature(Memory::SIGNATURE_D3D9_CALL_RESET);
         if(!d3d9_device_reset_sig) {
             throw std::runtime_error("Could not find signature for D3D9 device reset event");
         }
@@ -134,14 +155,16 @@ namespace Balltze::LegacyApi::Event {
         try {
             char *d3d9_device_reset_sig_ptr = reinterpret_cast<char *>(d3d9_device_reset_sig->data());
 
+            Memory::Hook *hook;
             if(d3d9_device_reset_sig_ptr[0] == 0xE9) {
                 // Workaround for Chimera hook (NEEDS TO BE FIXED)
                 std::byte *ptr = Memory::follow_32bit_jump(d3d9_device_reset_sig->data()) + 5;
-                Memory::hook_function(ptr, d3d9_device_reset_before_event, d3d9_device_reset_after_event, false);
+                hook = Memory::hook_function(ptr, d3d9_device_reset_before_event, d3d9_device_reset_after_event, false, true);
             }
             else {
-                Memory::hook_function(d3d9_device_reset_sig->data(), d3d9_device_reset_before_event, d3d9_device_reset_after_event, false);
+                hook = Memory::hook_function(d3d9_device_reset_sig->data(), d3d9_device_reset_before_event, d3d9_device_reset_after_event, false, true);
             }
+            set_event_hooks<D3D9DeviceResetEvent>({ hook });
         }
         catch(std::runtime_error &e) {
             throw std::runtime_error("Could not hook D3D9 device reset event: " + std::string(e.what()));
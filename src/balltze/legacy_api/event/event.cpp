@@ -1,92 +1,323 @@
 // SPDX-License-Identifier: GPL-3.0-only
 
+#include <array>
+#include <memory>
 #include <optional>
-#include <list>
 #include <stdexcept>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
 #include <balltze/legacy_api/event.hpp>
+#include <balltze/legacy_api/engine/game_state.hpp>
+#include <balltze/legacy_api/engine/tag.hpp>
+#include <balltze/memory.hpp>
+#include "../../events/listener_profiler.hpp"
+#include "../../events/listener_table.hpp"
+#include "../../logger.hpp"
 #include "console_command.hpp"
+#include "event.hpp"
+
+#define EVENT_FILTER_TYPE_COUNT (EVENT_FILTER_WIDGET_DEFINITION + 1)
+#define FILTERED_LISTENER_HANDLE_FLAG 0x80000000
 
 namespace Balltze::LegacyApi::Event {
+    /**
+     * Listener of an event; const callbacks are stored the same way, since T & binds to T const &
+     */
+    template<typename T>
+    using EventListener = Events::ProfiledListener<T>;
+
+    template<typename T>
+    static Events::ListenerTable<EventListener<T>> listeners;
+
+    /**
+     * Listeners that were added with a filter.
+     * There is one table for every filter value, so dispatching costs one lookup per filter type no matter
+     * how many filtered listeners there are. Tables are freed once they are empty and no dispatch is using them.
+     */
+    template<typename T>
+    struct FilteredListeners {
+        using Table = Events::ListenerTable<EventListener<T>>;
+
+        struct Handle {
+            /** Filter of the listener */
+            EventFilter filter;
+
+            /** Handle of the listener in the table of its filter */
+            std::size_t table_handle;
+        };
+
+        /** Listener tables by filter type and value */
+        std::array<std::unordered_map<std::uint32_t, std::unique_ptr<Table>>, EVENT_FILTER_TYPE_COUNT> tables;
+
+        /** Filter and table handle of every filtered listener */
+        std::unordered_map<std::size_t, Handle> handles;
+
+        /** Next filtered listener handle; handles have FILTERED_LISTENER_HANDLE_FLAG set, which table handles never have */
+        std::size_t next_handle = 0;
+    };
+
     template<typename T>
-    struct EventListener {
-        inline static std::size_t next_handle = 0;
-        
-        std::size_t handle;
-        bool constant = false;
-        EventPriority priority = EVENT_PRIORITY_DEFAULT;
-        std::optional<EventCallback<T>> ref_callback;
-        std::optional<ConstEventCallback<T>> const_callback;
+    static FilteredListeners<T> filtered_listeners;
+
+    /**
+     * Filter types supported by an event, as a mask of (1 << EventFilterType)
+     */
+    template<typename T>
+    constexpr unsigned int supported_event_filters = 0;
+
+    template<>
+    constexpr unsigned int supported_event_filters<SoundPlaybackEvent> = 1 << EVENT_FILTER_TAG_HANDLE;
+
+    template<>
+    constexpr unsigned int supported_event_filters<ObjectDamageEvent> = 1 << EVENT_FILTER_TAG_HANDLE | 1 << EVENT_FILTER_TAG_CLASS | 1 << EVENT_FILTER_OBJECT_TYPE;
+
+    template<>
+    constexpr unsigned int supported_event_filters<UIWidgetCreateEvent> = 1 << EVENT_FILTER_WIDGET_DEFINITION;
+
+    template<>
+    constexpr unsigned int supported_event_filters<UIWidgetBackEvent> = 1 << EVENT_FILTER_WIDGET_DEFINITION;
+
+    template<>
+    constexpr unsigned int supported_event_filters<UIWidgetFocusEvent> = 1 << EVENT_FILTER_WIDGET_DEFINITION;
+
+    template<>
+    constexpr unsigned int supported_event_filters<UIWidgetAcceptEvent> = 1 << EVENT_FILTER_WIDGET_DEFINITION;
 
-        bool remove_on_next_dispatch = false;
+    template<>
+    constexpr unsigned int supported_event_filters<UIWidgetListTabEvent> = 1 << EVENT_FILTER_WIDGET_DEFINITION;
 
-        EventListener() {
-            handle = next_handle++;
+    template<>
+    constexpr unsigned int supported_event_filters<UIWidgetMouseButtonPressEvent> = 1 << EVENT_FILTER_WIDGET_DEFINITION;
+
+    static std::optional<std::uint32_t> widget_filter_value(Engine::Widget *widget) noexcept {
+        if(!widget) {
+            return std::nullopt;
         }
+        return widget->definition_tag_handle.value;
+    }
 
-        void operator()(T &event) {
-            if(constant && const_callback) {
-                const_callback.value()(event);
+    /**
+     * Get the value of an event that is matched against the filters of a type.
+     * Only called for the filter types the event supports.
+     */
+    template<typename T>
+    static std::optional<std::uint32_t> event_filter_value(const T &event, EventFilterType type) noexcept {
+        if constexpr(std::is_same_v<T, SoundPlaybackEvent>) {
+            if(!event.context.permutation) {
+                return std::nullopt;
+            }
+            return event.context.permutation->sound_tag_handle_0.value;
+        }
+        else if constexpr(std::is_same_v<T, ObjectDamageEvent>) {
+            if(type == EVENT_FILTER_TAG_HANDLE) {
+                return event.context.damage_effect.value;
+            }
+            auto *object = Engine::get_object_table().get_object(event.context.object);
+            if(!object) {
+                return std::nullopt;
             }
-            else if(ref_callback) {
-                ref_callback.value()(event);
+            if(type == EVENT_FILTER_OBJECT_TYPE) {
+                return object->type;
+            }
+            auto *tag = Engine::get_tag(object->tag_handle);
+            if(!tag) {
+                return std::nullopt;
+            }
+            return tag->primary_class;
+        }
+        else if constexpr(std::is_same_v<T, UIWidgetCreateEvent>) {
+            return event.context.definition_tag_handle.value;
+        }
+        else if constexpr(std::is_same_v<T, UIWidgetListTabEvent>) {
+            return widget_filter_value(event.context.widget_list);
+        }
+        else if constexpr(supported_event_filters<T> != 0) {
+            return widget_filter_value(event.context.widget);
+        }
+        else {
+            return std::nullopt;
+        }
+    }
+
+    void set_event_hooks_installed(const std::vector<Memory::Hook *> &hooks, bool install) noexcept {
+        if(hooks.empty()) {
+            return;
+        }
+        try {
+            Memory::HookTransaction transaction;
+            for(auto *hook : hooks) {
+                transaction.add(hook);
+            }
+            if(install) {
+                transaction.commit();
             }
             else {
-                throw std::runtime_error("Event listener is not initialized");
+                transaction.revert();
             }
         }
-    };
+        catch(std::exception &e) {
+            logger.warning("Failed to {} event hooks: {}", install ? "install" : "release", e.what());
+        }
+    }
+
+    /**
+     * Update the listeners flag of an event, installing or releasing its hooks when it changes
+     */
+    template<typename T>
+    static void update_event_listeners() noexcept {
+        bool has_listeners = !listeners<T>.empty() || !filtered_listeners<T>.handles.empty();
+        if(has_listeners != event_has_listeners<T>) {
+            event_has_listeners<T> = has_listeners;
+            set_event_hooks_installed(event_hooks<T>, has_listeners);
+        }
+    }
+
+    /**
+     * Free a filtered listener table if it is empty and no dispatch is using it
+     */
+    template<typename T>
+    static void free_filtered_listener_table(EventFilterType type, std::uint32_t value) noexcept {
+        auto &tables = filtered_listeners<T>.tables[type];
+        auto it = tables.find(value);
+        if(it != tables.end() && it->second->empty() && !it->second->dispatching()) {
+            tables.erase(it);
+        }
+    }
+
+    template<typename T>
+    static std::size_t add_event_listener(Events::InlineCallback<void(T &)> callback, EventPriority priority, HMODULE module) {
+        auto *profile = Events::get_listener_profile(typeid(T), module);
+        auto handle = listeners<T>.add({ std::move(callback), profile }, priority);
+        update_event_listeners<T>();
+        return handle;
+    }
 
     template<typename T>
-    static std::list<EventListener<T>> listeners;
+    static std::size_t add_filtered_event_listener(Events::InlineCallback<void(T &)> callback, EventFilter filter, EventPriority priority, HMODULE module) {
+        if(static_cast<std::size_t>(filter.type) >= EVENT_FILTER_TYPE_COUNT || !(supported_event_filters<T> & (1 << filter.type))) {
+            throw std::runtime_error("Event does not support this filter");
+        }
+
+        auto &filtered = filtered_listeners<T>;
+        auto &table = filtered.tables[filter.type][filter.value];
+        if(!table) {
+            table = std::make_unique<typename FilteredListeners<T>::Table>();
+        }
+
+        auto *profile = Events::get_listener_profile(typeid(T), module);
+        auto table_handle = table->add({ std::move(callback), profile }, priority);
+        auto handle = (filtered.next_handle++ & (FILTERED_LISTENER_HANDLE_FLAG - 1)) | FILTERED_LISTENER_HANDLE_FLAG;
+        filtered.handles[handle] = { filter, table_handle };
+        update_event_listeners<T>();
+        return handle;
+    }
 
     template<typename T>
     std::size_t EventHandler<T>::add_listener(EventCallback<T> callback, EventPriority priority) {
-        auto &listener = listeners<T>.emplace_back();
-        listener.constant = false;
-        listener.priority = priority;
-        listener.ref_callback = callback;
-        return listener.handle;
+        return add_event_listener<T>(std::move(callback), priority, Memory::get_caller_module_handle());
     }
 
     template<typename T>
     std::size_t EventHandler<T>::add_listener_const(ConstEventCallback<T> callback, EventPriority priority) {
-        auto &listener = listeners<T>.emplace_back();
-        listener.constant = true;
-        listener.priority = priority;
-        listener.const_callback = callback;
-        return listener.handle;
+        return add_event_listener<T>(std::move(callback), priority, Memory::get_caller_module_handle());
+    }
+
+    template<typename T>
+    std::size_t EventHandler<T>::add_listener(EventCallback<T> callback, EventFilter filter, EventPriority priority) {
+        return add_filtered_event_listener<T>(std::move(callback), filter, priority, Memory::get_caller_module_handle());
+    }
+
+    template<typename T>
+    std::size_t EventHandler<T>::add_listener_const(ConstEventCallback<T> callback, EventFilter filter, EventPriority priority) {
+        return add_filtered_event_listener<T>(std::move(callback), filter, priority, Memory::get_caller_module_handle());
     }
 
     template<typename T>
     void EventHandler<T>::remove_listener(std::size_t handle) {
-        for(auto it = listeners<T>.begin(); it != listeners<T>.end(); ++it) {
-            if(it->handle == handle) {
-                it->remove_on_next_dispatch = true;
-                break;
+        if(handle & FILTERED_LISTENER_HANDLE_FLAG) {
+            auto &handles = filtered_listeners<T>.handles;
+            auto it = handles.find(handle);
+            if(it == handles.end()) {
+                return;
             }
+            auto [filter, table_handle] = it->second;
+            handles.erase(it);
+            filtered_listeners<T>.tables[filter.type].at(filter.value)->remove(table_handle);
+            free_filtered_listener_table<T>(filter.type, filter.value);
+        }
+        else if(!listeners<T>.remove(handle)) {
+            return;
         }
+        update_event_listeners<T>();
+    }
+
+    template<typename T>
+    bool EventHandler<T>::has_listeners() noexcept {
+        return event_has_listeners<T>;
     }
 
     template<typename T>
     void EventHandler<T>::dispatch(T &event) {
-        auto call_by_priority = [&](EventPriority priority) {
-            auto listener = listeners<T>.begin();
-            while(listener != listeners<T>.end()) {
-                if(listener->priority == priority) {
-                    if(listener->remove_on_next_dispatch) {
-                        listener = listeners<T>.erase(listener);
+        auto call = [&event](EventListener<T> &listener) {
+            if(!listener.callback) {
+                throw std::runtime_error("Event listener is not initialized");
+            }
+            Events::call_listener(listener, event);
+        };
+
+        if constexpr(supported_event_filters<T> != 0) {
+            auto &filtered = filtered_listeners<T>;
+            if(!filtered.handles.empty()) {
+                using Table = typename FilteredListeners<T>::Table;
+                std::array<std::pair<EventFilterType, std::uint32_t>, EVENT_FILTER_TYPE_COUNT> matching_filters;
+                std::array<Table *, EVENT_FILTER_TYPE_COUNT> matching_tables;
+                std::size_t matching_table_count = 0;
+                for(std::size_t type = 0; type < EVENT_FILTER_TYPE_COUNT; type++) {
+                    auto &tables = filtered.tables[type];
+                    if(tables.empty()) {
                         continue;
                     }
-                    (*listener)(event);
+                    auto value = event_filter_value(event, static_cast<EventFilterType>(type));
+                    if(!value) {
+                        continue;
+                    }
+                    auto it = tables.find(*value);
+                    if(it != tables.end() && !it->second->empty()) {
+                        matching_filters[matching_table_count] = { static_cast<EventFilterType>(type), *value };
+                        matching_tables[matching_table_count++] = it->second.get();
+                    }
+                }
+
+                // Interleave the matching tables with the unfiltered listeners so priorities still hold
+                if(matching_table_count > 0) {
+                    {
+                        // Every table stays in the dispatch until the walk ends, so listeners added meanwhile wait for the next one
+                        typename Table::DispatchGuard guard(listeners<T>);
+                        std::array<std::optional<typename Table::DispatchGuard>, EVENT_FILTER_TYPE_COUNT> matching_guards;
+                        for(std::size_t i = 0; i < matching_table_count; i++) {
+                            matching_guards[i].emplace(*matching_tables[i]);
+                        }
+
+                        for(std::size_t priority = EVENT_PRIORITY_HIGHEST + 1; priority-- > 0;) {
+                            listeners<T>.dispatch(priority, call);
+                            for(std::size_t i = 0; i < matching_table_count; i++) {
+                                matching_tables[i]->dispatch(priority, call);
+                            }
+                        }
+                    }
+
+                    // Tables emptied during the walk could not be freed while it was using them
+                    for(std::size_t i = 0; i < matching_table_count; i++) {
+                        free_filtered_listener_table<T>(matching_filters[i].first, matching_filters[i].second);
+                    }
+                    return;
                 }
-                listener++;
             }
-        };
+        }
 
-        call_by_priority(EVENT_PRIORITY_HIGHEST);
-        call_by_priority(EVENT_PRIORITY_ABOVE_DEFAULT);
-        call_by_priority(EVENT_PRIORITY_DEFAULT);
-        call_by_priority(EVENT_PRIORITY_LOWEST);
+        listeners<T>.dispatch(call);
     }
 
     template class EventHandler<TickEvent>;
@@ -3,7 +3,42 @@
 #ifndef BALLTZE__EVENT__EVENT_HPP
 #define BALLTZE__EVENT__EVENT_HPP
 
+#include <vector>
+#include <balltze/hook.hpp>
+
 namespace Balltze::LegacyApi::Event {
+    /**
+     * Whether an event has listeners.
+     * Dispatchers check this before building an event, so events nobody listens to cost almost nothing.
+     */
+    template<typename T>
+    inline bool event_has_listeners = false;
+
+    /**
+     * Hooks an event only needs while it has listeners
+     */
+    template<typename T>
+    inline std::vector<Memory::Hook *> event_hooks;
+
+    /**
+     * Install or release the hooks of an event
+     * @param hooks     Hooks of the event
+     * @param install   Install the hooks if true, release them if false
+     */
+    void set_event_hooks_installed(const std::vector<Memory::Hook *> &hooks, bool install) noexcept;
+
+    /**
+     * Set the hooks of an event.
+     * Hooks must be built with do_not_hook set; they are installed when the first listener is added and
+     * released when the last one is removed.
+     * @param hooks     Hooks of the event
+     */
+    template<typename T>
+    void set_event_hooks(std::vector<Memory::Hook *> hooks) noexcept {
+        event_hooks<T> = std::move(hooks);
+        set_event_hooks_installed(event_hooks<T>, event_has_listeners<T>);
+    }
+
     void set_up_events();
 }
 
@@ -4,14 +4,22 @@
 #include <balltze/legacy_api/event.hpp>
 #include <balltze/hook.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     static void frame_event_before_dispatcher() {
+        if(!event_has_listeners<FrameEvent>) {
+            return;
+        }
         FrameEvent frame_event(EVENT_TIME_BEFORE);
         frame_event.dispatch();
     }
 
     static void frame_event_after_dispatcher() {
+        if(!event_has_listeners<FrameEvent>) {
+            return;
+        }
         FrameEvent frame_event(EVENT_TIME_AFTER);
         frame_event.dispatch();
     }
@@ -28,17 +36,17 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *frame_event_sig = Memory::get_signature("on_frame");
+        auto *frame_event_sig = Memory::get_signature(Memory::SIGNATURE_ON_FRAME);
         if(!frame_event_sig) {
             throw std::runtime_error("Could not find signature for frame event");
         }
 
         // Workaround for Chimera hook (NEEDS TO BE FIXED)
         std::byte *ptr = Memory::follow_32bit_jump(frame_event_sig->data()) + 23;
-        auto *tick_event_after_chimera_hook = Memory::hook_function(ptr, frame_event_after_dispatcher);
+        Memory::get_hook_site(ptr)->add_handler(frame_event_after_dispatcher);
 
         try {
-            auto *tick_event_hook = Memory::hook_function(frame_event_sig->data(), frame_event_before_dispatcher);
+            Memory::get_hook_site(frame_event_sig->data())->add_handler(frame_event_before_dispatcher);
         }
         catch(std::runtime_error &e) {
             throw std::runtime_error("Could not hook frame event: " + std::string(e.what()));
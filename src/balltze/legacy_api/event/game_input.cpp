@@ -7,6 +7,9 @@
 #include <balltze/hook.hpp>
 #include <balltze/command.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "../../events/dispatch.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     extern "C" {
@@ -17,18 +20,34 @@ namespace Balltze::LegacyApi::Event {
     
         bool dispatch_input_event_before(LegacyApi::Engine::InputDevice device, std::size_t key_code, bool mapped) {
             GameInputEventContext args(device, key_code, mapped);
-            GameInputEvent event(EVENT_TIME_BEFORE, args);
-            event.dispatch();
-            return event.cancelled();
+            bool cancelled = false;
+            if(event_has_listeners<GameInputEvent>) {
+                GameInputEvent event(EVENT_TIME_BEFORE, args);
+                event.dispatch();
+                cancelled = event.cancelled();
+            }
+            if(device == LegacyApi::Engine::INPUT_DEVICE_KEYBOARD) {
+                cancelled = Events::dispatch_player_input_event(device, args.button.key_code, mapped) || cancelled;
+            }
+            else if(device == LegacyApi::Engine::INPUT_DEVICE_GAMEPAD) {
+                cancelled = Events::dispatch_player_input_event(device, args.button.gamepad_button, mapped) || cancelled;
+            }
+            return cancelled;
         }
 
         void dispatch_input_event_after(LegacyApi::Engine::InputDevice device, std::size_t key_code, bool mapped) {
+            if(!event_has_listeners<GameInputEvent>) {
+                return;
+            }
             GameInputEventContext args(device, key_code, mapped);
             GameInputEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
         }
 
         void dispatch_keypress_event(LegacyApi::Engine::InputGlobals::BufferedKey key) {
+            if(!event_has_listeners<KeyboardInputEvent>) {
+                return;
+            }
             KeyboardInputEventContext args(key);
             KeyboardInputEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -47,15 +66,15 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        static auto *keyboard_input_sig = Memory::get_signature("keyboard_input");
+        static auto *keyboard_input_sig = Memory::get_signature(Memory::SIGNATURE_KEYBOARD_INPUT);
         if(!keyboard_input_sig) {
             throw std::runtime_error("Could not find signature for keyboard input address");
         }
-        static auto *mouse_input_sig = Memory::get_signature("mouse_input");
+        static auto *mouse_input_sig = Memory::get_signature(Memory::SIGNATURE_MOUSE_INPUT);
         if(!mouse_input_sig) {
             throw std::runtime_error("Could not find signature for mouse input address");
         }
-        static auto *gamepad_input_sig = Memory::get_signature("gamepad_input");
+        static auto *gamepad_input_sig = Memory::get_signature(Memory::SIGNATURE_GAMEPAD_INPUT);
         if(!gamepad_input_sig) {
             throw std::runtime_error("Could not find signature for gamepad input address");
         }
@@ -87,7 +106,7 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        static auto *keyboard_input_sig = Memory::get_signature("keypress_event");
+        static auto *keyboard_input_sig = Memory::get_signature(Memory::SIGNATURE_KEYPRESS_EVENT);
         if(!keyboard_input_sig) {
             throw std::runtime_error("Could not find signature for keyboard input event");
         }
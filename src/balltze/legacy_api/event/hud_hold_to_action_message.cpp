@@ -7,6 +7,8 @@
 #include <balltze/hook.hpp>
 #include <balltze/legacy_api/event.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     static std::wstring new_text;
@@ -20,6 +22,9 @@ namespace Balltze::LegacyApi::Event {
         void hold_for_action_hud_message_after_event_button_name_right_quote();
     
         bool dispatch_hold_for_action_hud_message_before_event(const wchar_t **text, HudHoldForActionMessageSliceOffset *offset, LegacyApi::Engine::ColorARGBInt color, HudHoldForActionMessageSlice slice) {
+            if(!event_has_listeners<HudHoldForActionMessageEvent>) {
+                return false;
+            }
             HudHoldForActionMessageContext args(slice, {offset->x, offset->y}, color, *text, std::nullopt);
             HudHoldForActionMessageEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -33,12 +38,18 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_hold_for_action_hud_message_after_event(const wchar_t **text, LegacyApi::Engine::Point2DInt *offset, LegacyApi::Engine::ColorARGBInt color, HudHoldForActionMessageSlice slice) {
+            if(!event_has_listeners<HudHoldForActionMessageEvent>) {
+                return;
+            }
             HudHoldForActionMessageContext args(slice, {offset->x, offset->y}, color, *text, std::nullopt);
             HudHoldForActionMessageEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
         }
 
         bool dispatch_hold_for_action_hud_message_before_event_button_slice(const wchar_t **button_name, HudHoldForActionMessageSliceOffset *offset, LegacyApi::Engine::ColorARGBInt color, HudHoldToActionMessageButton *button) {
+            if(!event_has_listeners<HudHoldForActionMessageEvent>) {
+                return false;
+            }
             HudHoldForActionMessageContext args(HudHoldForActionMessageSlice::BUTTON_NAME, {offset->x, offset->y}, color, *button_name, *button);
             HudHoldForActionMessageEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -52,6 +63,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_hold_for_action_hud_message_after_event_button_slice(const wchar_t **button_name, LegacyApi::Engine::Point2DInt *offset, LegacyApi::Engine::ColorARGBInt color, HudHoldToActionMessageButton *button) {
+            if(!event_has_listeners<HudHoldForActionMessageEvent>) {
+                return;
+            }
             HudHoldForActionMessageContext args(HudHoldForActionMessageSlice::BUTTON_NAME, {offset->x, offset->y}, color, *button_name, *button);
             HudHoldForActionMessageEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
@@ -70,30 +84,32 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        static auto *hold_for_weapon_hud_button_name_draw_sig = Memory::get_signature("hold_for_weapon_hud_button_name_draw");
+        static auto *hold_for_weapon_hud_button_name_draw_sig = Memory::get_signature(Memory::SIGNATURE_HOLD_FOR_WEAPON_HUD_BUTTON_NAME_DRAW);
         if(!hold_for_weapon_hud_button_name_draw_sig) {
             throw std::runtime_error("Could not find signature for hold for action hud message button name draw");
         }
         
-        static auto *hold_for_action_message_left_quote_print_sig = Memory::get_signature("hold_for_action_message_left_quote_print");
+        static auto *hold_for_action_message_left_quote_print_sig = Memory::get_signature(Memory::SIGNATURE_HOLD_FOR_ACTION_MESSAGE_LEFT_QUOTE_PRINT);
         if(!hold_for_action_message_left_quote_print_sig) {
             throw std::runtime_error("Could not find signature for hold for action hud message left quote print");
         }
         
-        static auto *hold_for_action_message_right_quote_print_sig = Memory::get_signature("hold_for_action_message_right_quote_print");
+        static auto *hold_for_action_message_right_quote_print_sig = Memory::get_signature(Memory::SIGNATURE_HOLD_FOR_ACTION_MESSAGE_RIGHT_QUOTE_PRINT);
         if(!hold_for_action_message_right_quote_print_sig) {
             throw std::runtime_error("Could not find signature for hold for action hud message right quote print");
         }
 
         try {
             std::function<bool()> dispatcher = hold_for_action_hud_message_before_event_button_name;
-            auto *button_name_hook = Memory::hook_function(hold_for_weapon_hud_button_name_draw_sig->data(), dispatcher, hold_for_action_hud_message_after_event_button_name);
+            auto *button_name_hook = Memory::hook_function(hold_for_weapon_hud_button_name_draw_sig->data(), dispatcher, hold_for_action_hud_message_after_event_button_name, true, true);
 
             dispatcher = hold_for_action_hud_message_before_event_button_name_left_quote;
-            auto *left_quote_hook = Memory::hook_function(hold_for_action_message_left_quote_print_sig->data(), dispatcher, hold_for_action_hud_message_after_event_button_name_left_quote);
+            auto *left_quote_hook = Memory::hook_function(hold_for_action_message_left_quote_print_sig->data(), dispatcher, hold_for_action_hud_message_after_event_button_name_left_quote, true, true);
 
             dispatcher = hold_for_action_hud_message_before_event_button_name_right_quote;
-            auto *right_quote_hook = Memory::hook_function(hold_for_action_message_right_quote_print_sig->data(), dispatcher, hold_for_action_hud_message_after_event_button_name_right_quote);
+            auto *right_quote_hook = Memory::hook_function(hold_for_action_message_right_quote_print_sig->data(), dispatcher, hold_for_action_hud_message_after_event_button_name_right_quote, true, true);
+
+            set_event_hooks<HudHoldForActionMessageEvent>({ button_name_hook, left_quote_hook, right_quote_hook });
         }
         catch(std::runtime_error &e) {
             throw std::runtime_error("Could not hook hold for action hud message event: " + std::string(e.what()));
@@ -6,6 +6,9 @@
 #include <balltze/command.hpp>
 #include "../../config/config.hpp"
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "../../events/dispatch.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     static std::string current_map_name;
@@ -20,15 +23,21 @@ namespace Balltze::LegacyApi::Event {
             if(pos != std::string::npos) {
                 current_map_name = current_map_name.substr(pos + 1);
             }
-            MapLoadEventContext args(current_map_name);
-            MapLoadEvent event(EVENT_TIME_BEFORE, args);
-            event.dispatch();
+            if(event_has_listeners<MapLoadEvent>) {
+                MapLoadEventContext args(current_map_name);
+                MapLoadEvent event(EVENT_TIME_BEFORE, args);
+                event.dispatch();
+            }
+            Events::dispatch_map_load_event(current_map_name.c_str());
         }
 
         void dispatch_map_load_event_after() {
-            MapLoadEventContext args(current_map_name);
-            MapLoadEvent event(EVENT_TIME_AFTER, args);
-            event.dispatch();
+            if(event_has_listeners<MapLoadEvent>) {
+                MapLoadEventContext args(current_map_name);
+                MapLoadEvent event(EVENT_TIME_AFTER, args);
+                event.dispatch();
+            }
+            Events::dispatch_map_loaded_event(current_map_name.c_str());
         }
     }
 
@@ -42,8 +51,8 @@ namespace Balltze::LegacyApi::Event {
 
         auto loading_screen_enabled = Config::get_config().get<bool>("loading_screen.enable");
         if(!loading_screen_enabled.value_or(true)) {
-            auto *load_map_function_multiplayer_callload_map_path_sig = Memory::get_signature("load_map_function_multiplayer_call");
-            auto *load_map_function_singleplayer_call_sig = Memory::get_signature("load_map_function_singleplayer_call");
+            auto *load_map_function_multiplayer_callload_map_path_sig = Memory::get_signature(Memory::SIGNATURE_LOAD_MAP_FUNCTION_MULTIPLAYER_CALL);
+            auto *load_map_function_singleplayer_call_sig = Memory::get_signature(Memory::SIGNATURE_LOAD_MAP_FUNCTION_SINGLEPLAYER_CALL);
             if(!load_map_function_multiplayer_callload_map_path_sig || !load_map_function_singleplayer_call_sig) {
                 logger.error("Failed to find map load event signatures");
                 return;
@@ -64,6 +73,10 @@ namespace Balltze::LegacyApi::Event {
         void map_file_load_server_hook_asm();
 
         void dispatch_map_file_load_event_before(char *map_path, const char *map_name) {
+            if(!event_has_listeners<MapFileLoadEvent>) {
+                return;
+            }
+
             if(!map_path || !map_name) {
                 logger.debug("dispatch_map_file_load_event_before: map_path or map_name is null");
             }
@@ -88,7 +101,7 @@ namespace Balltze::LegacyApi::Event {
         enabled = true;
 
         try {
-            auto *load_map_path_sig = Memory::get_signature("map_load_path");
+            auto *load_map_path_sig = Memory::get_signature(Memory::SIGNATURE_MAP_LOAD_PATH);
             std::uint8_t load_map_path_instruction = *reinterpret_cast<std::uint8_t *>(load_map_path_sig->data());
             std::byte *load_map_path_addr = load_map_path_sig->data();
 
@@ -96,12 +109,9 @@ namespace Balltze::LegacyApi::Event {
                 load_map_path_addr = Memory::follow_32bit_jump(load_map_path_addr) + 14; // let Chimera overwrite the map path
             }
 
-            if(get_balltze_side() == BALLTZE_SIDE_CLIENT) {
-                auto *load_map_path_hook = Memory::hook_function(load_map_path_addr, map_file_load_client_hook_asm);
-            }
-            else {
-                auto *load_map_path_hook = Memory::hook_function(load_map_path_addr, map_file_load_server_hook_asm);
-            }
+            auto *load_map_path_hook_function = get_balltze_side() == BALLTZE_SIDE_CLIENT ? map_file_load_client_hook_asm : map_file_load_server_hook_asm;
+            auto *load_map_path_hook = Memory::hook_function(load_map_path_addr, load_map_path_hook_function, std::nullopt, true, true);
+            set_event_hooks<MapFileLoadEvent>({ load_map_path_hook });
         }
         catch(std::runtime_error &e) {
             logger.error("failed to initialize map loading event: {}", e.what());
@@ -113,6 +123,9 @@ namespace Balltze::LegacyApi::Event {
         void map_file_data_read_event_after();
 
         void dispatch_map_file_data_read_event_before(HANDLE file_descriptor, std::byte *output, std::size_t *size, LPOVERLAPPED overlapped) {
+            if(!event_has_listeners<MapFileDataReadEvent>) {
+                return;
+            }
             MapFileDataReadEventContext args;
             args.file_handle = file_descriptor;
             args.output_buffer = output;
@@ -124,6 +137,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_map_file_data_read_event_after(HANDLE file_descriptor, std::byte *output, std::size_t size, LPOVERLAPPED overlapped) {
+            if(!event_has_listeners<MapFileDataReadEvent>) {
+                return;
+            }
             MapFileDataReadEventContext args;
             args.file_handle = file_descriptor;
             args.output_buffer = output;
@@ -142,16 +158,17 @@ namespace Balltze::LegacyApi::Event {
         }
         enabled = true;
 
-        auto *read_map_file_data_call_1_sig = Memory::get_signature("read_map_file_data_call_1");
-        auto *read_map_file_data_call_2_sig = Memory::get_signature("read_map_file_data_call_2");
+        auto *read_map_file_data_call_1_sig = Memory::get_signature(Memory::SIGNATURE_READ_MAP_FILE_DATA_CALL_1);
+        auto *read_map_file_data_call_2_sig = Memory::get_signature(Memory::SIGNATURE_READ_MAP_FILE_DATA_CALL_2);
         
         if(!read_map_file_data_call_1_sig || !read_map_file_data_call_2_sig) {
             throw std::runtime_error("Could not find signatures for map file data read event");
         }
 
         try {
-            Memory::hook_function(read_map_file_data_call_1_sig->data(), map_file_data_read_event_before, map_file_data_read_event_after);
-            Memory::hook_function(read_map_file_data_call_2_sig->data(), map_file_data_read_event_before, map_file_data_read_event_after);
+            auto *read_map_file_data_call_1_hook = Memory::hook_function(read_map_file_data_call_1_sig->data(), map_file_data_read_event_before, map_file_data_read_event_after, true, true);
+            auto *read_map_file_data_call_2_hook = Memory::hook_function(read_map_file_data_call_2_sig->data(), map_file_data_read_event_before, map_file_data_read_event_after, true, true);
+            set_event_hooks<MapFileDataReadEvent>({ read_map_file_data_call_1_hook, read_map_file_data_call_2_hook });
         }
         catch(std::runtime_error &e) {
             throw std::runtime_error("Could not hook map file data read event: " + std::string(e.what()));
@@ -7,6 +7,8 @@
 #include <balltze/api.hpp>
 #include <balltze/command.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     extern "C" {
@@ -15,6 +17,9 @@ namespace Balltze::LegacyApi::Event {
         void *network_game_decode_hud_message_call_override_return = nullptr;
 
         bool dispatch_network_game_chat_message_event_before(NetworkGameChatMessage *chat_message) {
+            if(!event_has_listeners<NetworkGameChatMessageEvent>) {
+                return false;
+            }
             NetworkGameChatMessageEventContext args(chat_message);
             NetworkGameChatMessageEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -22,6 +27,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_network_game_chat_message_event_after(NetworkGameChatMessage *chat_message) {
+            if(!event_has_listeners<NetworkGameChatMessageEvent>) {
+                return;
+            }
             NetworkGameChatMessageEventContext args(chat_message);
             NetworkGameChatMessageEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
@@ -74,6 +82,9 @@ namespace Balltze::LegacyApi::Event {
         void *netgame_sound_fn_return;
 
         bool dispatch_network_game_sound_event_before(LegacyApi::Engine::NetworkGameMultiplayerSound sound) {
+            if(!event_has_listeners<NetworkGameMultiplayerSoundEvent>) {
+                return false;
+            }
             NetworkGameMultiplayerSoundEventContext args = { .sound = sound };
             NetworkGameMultiplayerSoundEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -81,6 +92,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_network_game_sound_event_after(LegacyApi::Engine::NetworkGameMultiplayerSound sound) {
+            if(!event_has_listeners<NetworkGameMultiplayerSoundEvent>) {
+                return;
+            }
             NetworkGameMultiplayerSoundEventContext args = { .sound = sound };
             NetworkGameMultiplayerSoundEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
@@ -99,13 +113,14 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *netgame_sound_sig = Memory::get_signature("network_game_multiplayer_sound_call");
+        auto *netgame_sound_sig = Memory::get_signature(Memory::SIGNATURE_NETWORK_GAME_MULTIPLAYER_SOUND_CALL);
         if(!netgame_sound_sig) {
             throw std::runtime_error("Could not find signature for network game sound event");
         }
 
         try {
-            auto *hook = Memory::override_function(netgame_sound_sig->data(), netgame_sound_override, &netgame_sound_fn_return);
+            auto *hook = Memory::override_function(netgame_sound_sig->data(), netgame_sound_override, &netgame_sound_fn_return, true);
+            set_event_hooks<NetworkGameMultiplayerSoundEvent>({ hook });
         }
         catch(const std::runtime_error &e) {
             throw std::runtime_error("Could not hook network game sound event: " + std::string(e.what()));
@@ -117,6 +132,9 @@ namespace Balltze::LegacyApi::Event {
         void network_game_multiplayer_hud_message_event_after_asm();
     
         bool dispatch_network_game_multiplayer_hud_message_before(LegacyApi::Engine::NetworkGameMultiplayerHudMessage message_type, LegacyApi::Engine::PlayerHandle causer, LegacyApi::Engine::PlayerHandle victim, LegacyApi::Engine::PlayerHandle local_player) {
+            if(!event_has_listeners<NetworkGameHudMessageEvent>) {
+                return false;
+            }
             NetworkGameHudMessageEventContext args = { .message_type = message_type, .causer = causer, .victim = victim, .local_player = local_player };
             NetworkGameHudMessageEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -124,6 +142,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_network_game_multiplayer_hud_message_after(LegacyApi::Engine::NetworkGameMultiplayerHudMessage message_type, LegacyApi::Engine::PlayerHandle causer, LegacyApi::Engine::PlayerHandle victim, LegacyApi::Engine::PlayerHandle local_player) {
+            if(!event_has_listeners<NetworkGameHudMessageEvent>) {
+                return;
+            }
             NetworkGameHudMessageEventContext args = { .message_type = message_type, .causer = causer, .victim = victim, .local_player = local_player };
             NetworkGameHudMessageEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
@@ -142,14 +163,15 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *network_game_multiplayer_hud_message_event_before_sig = Memory::get_signature("network_game_multiplayer_hud_message_dispatch_call");
+        auto *network_game_multiplayer_hud_message_event_before_sig = Memory::get_signature(Memory::SIGNATURE_NETWORK_GAME_MULTIPLAYER_HUD_MESSAGE_DISPATCH_CALL);
         if(!network_game_multiplayer_hud_message_event_before_sig) {
             throw std::runtime_error("Could not find signature for network game hud message event");
         }
 
         try {
             std::function<bool()> before_function = network_game_multiplayer_hud_message_event_before_asm;
-            auto *hook = Memory::hook_function(network_game_multiplayer_hud_message_event_before_sig->data(), before_function, network_game_multiplayer_hud_message_event_after_asm);
+            auto *hook = Memory::hook_function(network_game_multiplayer_hud_message_event_before_sig->data(), before_function, network_game_multiplayer_hud_message_event_after_asm, true, true);
+            set_event_hooks<NetworkGameHudMessageEvent>({ hook });
         }
         catch(const std::runtime_error &e) {
             throw std::runtime_error("Could not hook network game hud message event: " + std::string(e.what()));
@@ -5,6 +5,8 @@
 #include <balltze/hook.hpp>
 #include <balltze/command.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     extern "C" {
@@ -12,6 +14,9 @@ namespace Balltze::LegacyApi::Event {
         void *object_damage_function_address = nullptr;
         
         bool dispatch_object_damage_event_before(LegacyApi::Engine::ObjectHandle *object, LegacyApi::Engine::DamageObjectStructThing *damage_thing) {
+            if(!event_has_listeners<ObjectDamageEvent>) {
+                return false;
+            }
             ObjectDamageEventContext args(*object, damage_thing->damage_tag_handle, damage_thing->multiplier, damage_thing->causer_player, damage_thing->causer_object);
             ObjectDamageEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -19,6 +24,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_object_damage_event_after(LegacyApi::Engine::ObjectHandle *object, LegacyApi::Engine::DamageObjectStructThing *damage_thing) {
+            if(!event_has_listeners<ObjectDamageEvent>) {
+                return;
+            }
             ObjectDamageEventContext args(*object, damage_thing->damage_tag_handle, damage_thing->multiplier, damage_thing->causer_player, damage_thing->causer_object);
             ObjectDamageEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
@@ -33,13 +41,14 @@ namespace Balltze::LegacyApi::Event {
         }
         enabled = true;
 
-        auto *apply_damage_function_sig = Memory::get_signature("apply_damage_function");
+        auto *apply_damage_function_sig = Memory::get_signature(Memory::SIGNATURE_APPLY_DAMAGE_FUNCTION);
         if(!apply_damage_function_sig) {
             throw std::runtime_error("Could not find signature for object damage event");
         }
 
         try {
-            Memory::override_function(apply_damage_function_sig->data() + 6, object_damage_event, &object_damage_function_address);
+            auto *hook = Memory::override_function(apply_damage_function_sig->data() + 6, object_damage_event, &object_damage_function_address, true);
+            set_event_hooks<ObjectDamageEvent>({ hook });
         }
         catch(const std::runtime_error &e) {
             throw std::runtime_error("Could not hook object damage event: " + std::string(e.what()));
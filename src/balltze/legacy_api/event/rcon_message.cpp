@@ -7,6 +7,8 @@
 #include <balltze/command.hpp>
 #include <balltze/helpers/string.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     extern "C" {
@@ -16,6 +18,9 @@ namespace Balltze::LegacyApi::Event {
         void rcon_message_event_after_hook();
 
         bool dispatch_rcon_message_event_before(char *message_data) {
+            if(!event_has_listeners<RconMessageEvent>) {
+                return false;
+            }
             std::optional<std::string> decoded_message;
             try {
                 decoded_message = string_w1252_to_utf8(message_data);
@@ -30,6 +35,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_rcon_message_event_after(char *message_data) {
+            if(!event_has_listeners<RconMessageEvent>) {
+                return;
+            }
             std::optional<std::string> decoded_message;
             try {
                 decoded_message = string_w1252_to_utf8(message_data);
@@ -55,7 +63,7 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *rcon_message_function_call_sig = Memory::get_signature("rcon_message_function_call");
+        auto *rcon_message_function_call_sig = Memory::get_signature(Memory::SIGNATURE_RCON_MESSAGE_FUNCTION_CALL);
         if(!rcon_message_function_call_sig) {
             throw std::runtime_error("Could not find signature for rcon message event");
         }
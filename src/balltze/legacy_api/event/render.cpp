@@ -6,6 +6,8 @@
 #include <balltze/hook.hpp>
 #include <balltze/command.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     static std::uint32_t render_user_interface_param;
@@ -15,6 +17,9 @@ namespace Balltze::LegacyApi::Event {
     
         bool ui_render_event_before_dispatcher(std::uint32_t unknown) {
             render_user_interface_param = unknown;
+            if(!event_has_listeners<UIRenderEvent>) {
+                return false;
+            }
             UIRenderEventContext args = {unknown};
             UIRenderEvent ui_render_event(EVENT_TIME_BEFORE, args);
             ui_render_event.dispatch();
@@ -22,6 +27,9 @@ namespace Balltze::LegacyApi::Event {
         }
     
         void ui_render_event_after_dispatcher() {
+            if(!event_has_listeners<UIRenderEvent>) {
+                return;
+            }
             UIRenderEventContext args = {render_user_interface_param};
             UIRenderEvent ui_render_event(EVENT_TIME_AFTER, args);
             ui_render_event.dispatch();
@@ -40,7 +48,7 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *render_user_interface_sig = Memory::get_signature("render_user_interface_function_call");
+        auto *render_user_interface_sig = Memory::get_signature(Memory::SIGNATURE_RENDER_USER_INTERFACE_FUNCTION_CALL);
         if(!render_user_interface_sig) {
             throw std::runtime_error("Could not find signature for UI render event");
         }
@@ -49,12 +57,18 @@ namespace Balltze::LegacyApi::Event {
     }
 
     static bool hud_render_event_before_dispatcher() {
+        if(!event_has_listeners<HUDRenderEvent>) {
+            return false;
+        }
         HUDRenderEvent hud_render_event(EVENT_TIME_BEFORE);
         hud_render_event.dispatch();
         return hud_render_event.cancelled();
     }
 
     static void hud_render_event_after_dispatcher() {
+        if(!event_has_listeners<HUDRenderEvent>) {
+            return;
+        }
         HUDRenderEvent hud_render_event(EVENT_TIME_AFTER);
         hud_render_event.dispatch();
     }
@@ -71,7 +85,7 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *render_hud_sig = Memory::get_signature("render_hud_function_call");
+        auto *render_hud_sig = Memory::get_signature(Memory::SIGNATURE_RENDER_HUD_FUNCTION_CALL);
         if(!render_hud_sig) {
             throw std::runtime_error("Could not find signature for HUD render event");
         }
@@ -80,12 +94,18 @@ namespace Balltze::LegacyApi::Event {
     }
 
     static bool post_carnage_report_render_event_before_dispatcher() {
+        if(!event_has_listeners<PostCarnageReportRenderEvent>) {
+            return false;
+        }
         PostCarnageReportRenderEvent post_carnage_report_render_event(EVENT_TIME_BEFORE);
         post_carnage_report_render_event.dispatch();
         return post_carnage_report_render_event.cancelled();
     }
 
     static void post_carnage_report_render_event_after_dispatcher() {
+        if(!event_has_listeners<PostCarnageReportRenderEvent>) {
+            return;
+        }
         PostCarnageReportRenderEvent post_carnage_report_render_event(EVENT_TIME_AFTER);
         post_carnage_report_render_event.dispatch();
     }
@@ -102,7 +122,7 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *render_post_carnage_report_call_sig = Memory::get_signature("render_post_carnage_report_call");
+        auto *render_post_carnage_report_call_sig = Memory::get_signature(Memory::SIGNATURE_RENDER_POST_CARNAGE_REPORT_CALL);
         if(!render_post_carnage_report_call_sig) {
             throw std::runtime_error("Could not find signature for post carnage report render event");
         }
@@ -117,16 +137,22 @@ namespace Balltze::LegacyApi::Event {
         void hud_element_bitmap_render_event_after_dispatcher_asm();
     
         bool hud_element_bitmap_render_event_before_dispatcher(LegacyApi::Engine::ScreenQuad &quad, LegacyApi::Engine::TagDefinitions::BitmapData *bitmap_data) {
+            hud_element_bitmap_render_event_bitmap_data = bitmap_data;
+            if(!event_has_listeners<HUDElementBitmapRenderEvent>) {
+                return false;
+            }
             HUDElementBitmapRenderEventContext args;
             args.quad = &quad;
             args.bitmap_data = bitmap_data;
-            hud_element_bitmap_render_event_bitmap_data = bitmap_data;
             HUDElementBitmapRenderEvent widget_background_render_event(EVENT_TIME_BEFORE, args);
             widget_background_render_event.dispatch();
             return widget_background_render_event.cancelled();
         }
     
         void hud_element_bitmap_render_event_after_dispatcher(LegacyApi::Engine::ScreenQuad &quad) {
+            if(!event_has_listeners<HUDElementBitmapRenderEvent>) {
+                return;
+            }
             HUDElementBitmapRenderEventContext args;
             args.quad = &quad;
             args.bitmap_data = hud_element_bitmap_render_event_bitmap_data;
@@ -150,7 +176,7 @@ namespace Balltze::LegacyApi::Event {
         }
 
         hud_element_bitmap_render_event_init_tick_event_handle = TickEvent::subscribe([](TickEvent const &event) {
-            auto *render_hud_element_bitmap_function_call_sig = Memory::get_signature("render_hud_element_bitmap_function_call");
+            auto *render_hud_element_bitmap_function_call_sig = Memory::get_signature(Memory::SIGNATURE_RENDER_HUD_ELEMENT_BITMAP_FUNCTION_CALL);
             if(!render_hud_element_bitmap_function_call_sig) {
                 throw std::runtime_error("Could not find signature for HUD element bitmap render event");
             }
@@ -173,6 +199,9 @@ namespace Balltze::LegacyApi::Event {
         void widget_background_render_event_after_dispatcher_asm();
     
         bool widget_background_render_event_before_dispatcher(LegacyApi::Engine::ScreenQuad &quad, LegacyApi::Engine::Widget *widget) {
+            if(!event_has_listeners<UIWidgetBackgroundRenderEvent>) {
+                return false;
+            }
             UIWidgetBackgroundRenderEventContext args;
             args.quad = &quad;
             args.widget = widget;
@@ -182,6 +211,9 @@ namespace Balltze::LegacyApi::Event {
         }
     
         void widget_background_render_event_after_dispatcher(LegacyApi::Engine::ScreenQuad &quad, LegacyApi::Engine::Widget *widget) {
+            if(!event_has_listeners<UIWidgetBackgroundRenderEvent>) {
+                return;
+            }
             UIWidgetBackgroundRenderEventContext args;
             args.quad = &quad;
             args.widget = widget;
@@ -205,7 +237,7 @@ namespace Balltze::LegacyApi::Event {
         }
 
         widget_background_render_event_init_tick_event_handle = TickEvent::subscribe([](TickEvent const &event) {
-            auto *render_widget_background_function_call_sig = Memory::get_signature("render_widget_background_function_call");
+            auto *render_widget_background_function_call_sig = Memory::get_signature(Memory::SIGNATURE_RENDER_WIDGET_BACKGROUND_FUNCTION_CALL);
             if(!render_widget_background_function_call_sig) {
                 throw std::runtime_error("Could not find signature for widget background render event");
             }
@@ -218,12 +250,18 @@ namespace Balltze::LegacyApi::Event {
     }
 
     static bool navpoints_render_event_before_dispatcher() {
+        if(!event_has_listeners<NavPointsRenderEvent>) {
+            return false;
+        }
         NavPointsRenderEvent navpoints_render_event(EVENT_TIME_BEFORE);
         navpoints_render_event.dispatch();
         return navpoints_render_event.cancelled();
     }
 
     static void navpoints_render_event_after_dispatcher() {
+        if(!event_has_listeners<NavPointsRenderEvent>) {
+            return;
+        }
         NavPointsRenderEvent navpoints_render_event(EVENT_TIME_AFTER);
         navpoints_render_event.dispatch();
     }
@@ -243,7 +281,7 @@ namespace Balltze::LegacyApi::Event {
         }
 
         navpoints_render_event_init_tick_event_handle = TickEvent::subscribe([](TickEvent const &event) {
-            auto *render_navpoint_function_call_sig = Memory::get_signature("render_navpoint_function_call");
+            auto *render_navpoint_function_call_sig = Memory::get_signature(Memory::SIGNATURE_RENDER_NAVPOINT_FUNCTION_CALL);
             if(!render_navpoint_function_call_sig) {
                 throw std::runtime_error("Could not find signature for navpoints render event");
             }
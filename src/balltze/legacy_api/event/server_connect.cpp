@@ -6,6 +6,8 @@
 #include <balltze/hook.hpp>
 #include <balltze/command.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     static std::unique_ptr<ServerConnectEventContext> server_connect_event_args;
@@ -15,6 +17,9 @@ namespace Balltze::LegacyApi::Event {
         void server_connect_event_after() noexcept;
         
         bool dispatch_server_connect_event_before(std::uint32_t &address, std::uint16_t &port, wchar_t *password) {
+            if(!event_has_listeners<ServerConnectEvent>) {
+                return false;
+            }
             server_connect_event_args = std::make_unique<ServerConnectEventContext>(address, port, password);
             ServerConnectEvent event(EVENT_TIME_BEFORE, *server_connect_event_args);
             event.dispatch();
@@ -22,6 +27,10 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_server_connect_event_after() {
+            if(!event_has_listeners<ServerConnectEvent> || !server_connect_event_args) {
+                server_connect_event_args = nullptr;
+                return;
+            }
             ServerConnectEvent event(EVENT_TIME_AFTER, *server_connect_event_args);
             event.dispatch();
             server_connect_event_args = nullptr;
@@ -51,7 +60,7 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *server_connect_function_call_sig = Memory::get_signature("server_connect_function_call");
+        auto *server_connect_function_call_sig = Memory::get_signature(Memory::SIGNATURE_SERVER_CONNECT_FUNCTION_CALL);
         if(!server_connect_function_call_sig) {
             throw std::runtime_error("Could not find signature for server connnect event");
         }
@@ -59,7 +68,8 @@ namespace Balltze::LegacyApi::Event {
         try {
             std::function<bool()> before = reinterpret_cast<bool (*)()>(server_connect_event_before);
             std::function<void()> after = reinterpret_cast<void (*)()>(server_connect_event_after);
-            Memory::hook_function(server_connect_function_call_sig->data(), before, after);
+            auto *hook = Memory::hook_function(server_connect_function_call_sig->data(), before, after, true, true);
+            set_event_hooks<ServerConnectEvent>({ hook });
         }
         catch(const std::runtime_error &e) {
             throw std::runtime_error("Could not hook server connnect event: " + std::string(e.what()));
@@ -9,6 +9,8 @@
 #include <balltze/legacy_api/engine/tag.hpp>
 #include <balltze/legacy_api/engine/tag_definitions/sound.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     extern "C" {
@@ -16,6 +18,9 @@ namespace Balltze::LegacyApi::Event {
         void *sound_playback_function = nullptr;
 
         bool dispatch_sound_playback_event_before(LegacyApi::Engine::TagDefinitions::SoundPermutation *permutation) {
+            if(!event_has_listeners<SoundPlaybackEvent>) {
+                return false;
+            }
             auto *tag = LegacyApi::Engine::get_tag(permutation->sound_tag_handle_0);
             if(!tag) {
                 logger.debug("Could not find tag for permutation {} in dispatch_sound_playback_event_before", permutation->name.string);
@@ -29,6 +34,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_sound_playback_event_after(LegacyApi::Engine::TagDefinitions::SoundPermutation *permutation) {
+            if(!event_has_listeners<SoundPlaybackEvent>) {
+                return;
+            }
             auto *tag = LegacyApi::Engine::get_tag(permutation->sound_tag_handle_0);
             if(!tag) {
                 logger.debug("Could not find tag for permutation {} in dispatch_sound_playback_event_before", permutation->name.string);
@@ -53,13 +61,14 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *enqueue_sound_permutation_function_sig = Memory::get_signature("enqueue_sound_function");
+        auto *enqueue_sound_permutation_function_sig = Memory::get_signature(Memory::SIGNATURE_ENQUEUE_SOUND_FUNCTION);
         if(!enqueue_sound_permutation_function_sig) {
             throw std::runtime_error("Could not find signatures for sound playback event");
         }
 
         try {
-            Memory::override_function(enqueue_sound_permutation_function_sig->data(), sound_playback_event, &sound_playback_function);
+            auto *hook = Memory::override_function(enqueue_sound_permutation_function_sig->data(), sound_playback_event, &sound_playback_function, true);
+            set_event_hooks<SoundPlaybackEvent>({ hook });
         }
         catch(const std::runtime_error &e) {
             throw std::runtime_error("Could not hook sound playback event: " + std::string(e.what()));
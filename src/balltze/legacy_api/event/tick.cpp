@@ -7,6 +7,9 @@
 #include <balltze/memory.hpp>
 #include <balltze/hook.hpp>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "../../events/dispatch.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     static bool first_tick = true;
@@ -14,6 +17,9 @@ namespace Balltze::LegacyApi::Event {
     static std::chrono::milliseconds tick_duration = std::chrono::milliseconds(0);
 
     static void tick_event_before_dispatcher() {
+        if(!event_has_listeners<TickEvent>) {
+            return;
+        }
         auto tick_count = LegacyApi::Engine::get_tick_count();
         TickEventContext args(tick_duration.count(), tick_count);
         TickEvent tick_event(EVENT_TIME_BEFORE, args);
@@ -30,9 +36,12 @@ namespace Balltze::LegacyApi::Event {
             first_tick = false;
         }
         last_tick = current_tick;
-        TickEventContext args(tick_duration.count(), tick_count);
-        TickEvent tick_event(EVENT_TIME_AFTER, args);
-        tick_event.dispatch();
+        if(event_has_listeners<TickEvent>) {
+            TickEventContext args(tick_duration.count(), tick_count);
+            TickEvent tick_event(EVENT_TIME_AFTER, args);
+            tick_event.dispatch();
+        }
+        Events::dispatch_tick_event();
     }
 
     template<>
@@ -43,7 +52,7 @@ namespace Balltze::LegacyApi::Event {
         }
         enabled = true;
 
-        static auto *tick_event_sig = Memory::get_signature("on_tick");
+        static auto *tick_event_sig = Memory::get_signature(Memory::SIGNATURE_ON_TICK);
         if(!tick_event_sig) {
             throw std::runtime_error("Could not find signature for tick event");
         }
@@ -51,12 +60,14 @@ namespace Balltze::LegacyApi::Event {
         try {
             std::uint8_t instruction_byte = *reinterpret_cast<std::uint8_t *>(tick_event_sig->data());
             if(instruction_byte == 0xE8) {
-                Memory::hook_function(tick_event_sig->data(), tick_event_before_dispatcher, tick_event_after_dispatcher);
+                auto *tick_event_site = Memory::get_hook_site(tick_event_sig->data());
+                tick_event_site->add_handler(tick_event_before_dispatcher);
+                tick_event_site->add_handler(tick_event_after_dispatcher, true);
             }
             else {
                 std::byte *ptr = Memory::follow_32bit_jump(tick_event_sig->data()) + 23;
-                auto *tick_event_after_chimera_hook = Memory::hook_function(ptr, tick_event_after_dispatcher);
-                Memory::hook_function(tick_event_sig->data(), tick_event_before_dispatcher);
+                Memory::get_hook_site(ptr)->add_handler(tick_event_after_dispatcher);
+                Memory::get_hook_site(tick_event_sig->data())->add_handler(tick_event_before_dispatcher);
             }
         }
         catch(const std::runtime_error &e) {
@@ -9,9 +9,14 @@
 #include <event/event.h>
 #include <impl/interface/ui_widget.h>
 #include "../../logger.hpp"
+#include "../../memory/memory.hpp"
+#include "event.hpp"
 
 namespace Balltze::LegacyApi::Event {
     static void dispatch_widget_create_event(LegacyApi::Engine::Widget *widget) {
+        if(!event_has_listeners<UIWidgetCreateEvent>) {
+            return;
+        }
         UIWidgetCreateEventContext args{reinterpret_cast<LegacyApi::Engine::Widget *>(widget), widget->definition_tag_handle.value, widget->parent_widget == nullptr, widget->parent_widget};
         UIWidgetCreateEvent widget_create_event_before(EVENT_TIME_BEFORE, args);
         widget_create_event_before.dispatch();
@@ -66,6 +71,9 @@ namespace Balltze::LegacyApi::Event {
         void *widget_back_function_override_return;
 
         bool dispatch_widget_back_before_event(LegacyApi::Engine::Widget *widget) {
+            if(!event_has_listeners<UIWidgetBackEvent>) {
+                return false;
+            }
             UIWidgetEventContext args{widget};
             UIWidgetBackEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -73,6 +81,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_widget_back_after_event(LegacyApi::Engine::Widget *widget) {
+            if(!event_has_listeners<UIWidgetBackEvent>) {
+                return;
+            }
             UIWidgetEventContext args{widget};
             UIWidgetBackEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
@@ -91,13 +102,14 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *widget_back_function_sig = Memory::get_signature("widget_back_function");
+        auto *widget_back_function_sig = Memory::get_signature(Memory::SIGNATURE_WIDGET_BACK_FUNCTION);
         if(!widget_back_function_sig) {
             throw std::runtime_error("Could not find signatures for widget close event.");
         }
 
         try {
-            Memory::override_function(widget_back_function_sig->data(), widget_back_event_asm, &widget_back_function_override_return);
+            auto *hook = Memory::override_function(widget_back_function_sig->data(), widget_back_event_asm, &widget_back_function_override_return, true);
+            set_event_hooks<UIWidgetBackEvent>({ hook });
         }
         catch(const std::runtime_error &e) {
             throw std::runtime_error("failed to initialize widget close event: " + std::string(e.what()));
@@ -111,6 +123,9 @@ namespace Balltze::LegacyApi::Event {
         void *widget_focus_function_override_return;
 
         bool dispatch_widget_focus_before_event(LegacyApi::Engine::Widget *widget) {
+            if(!event_has_listeners<UIWidgetFocusEvent>) {
+                return false;
+            }
             UIWidgetEventContext args{widget};
             UIWidgetFocusEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -118,6 +133,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_widget_focus_after_event(LegacyApi::Engine::Widget *widget) {
+            if(!event_has_listeners<UIWidgetFocusEvent>) {
+                return;
+            }
             UIWidgetEventContext args{widget};
             UIWidgetFocusEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
@@ -136,16 +154,17 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *widget_focus_function_sig = Memory::get_signature("widget_focus_function");
-        auto *widget_mouse_focus_update_sig = Memory::get_signature("widget_mouse_focus_update");
+        auto *widget_focus_function_sig = Memory::get_signature(Memory::SIGNATURE_WIDGET_FOCUS_FUNCTION);
+        auto *widget_mouse_focus_update_sig = Memory::get_signature(Memory::SIGNATURE_WIDGET_MOUSE_FOCUS_UPDATE);
         if(!widget_focus_function_sig || !widget_mouse_focus_update_sig) {
             throw std::runtime_error("Could not find signatures for widget focus event.");
         }
 
         try {
-            Memory::override_function(widget_focus_function_sig->data(), widget_focus_event_asm, &widget_focus_function_override_return);
+            auto *focus_hook = Memory::override_function(widget_focus_function_sig->data(), widget_focus_event_asm, &widget_focus_function_override_return, true);
             std::function<bool()> mouse_focus_update_before = widget_mouse_focus_update_before_asm;
-            Memory::hook_function(widget_mouse_focus_update_sig->data(), mouse_focus_update_before, widget_mouse_focus_update_after_asm, true);
+            auto *mouse_focus_update_hook = Memory::hook_function(widget_mouse_focus_update_sig->data(), mouse_focus_update_before, widget_mouse_focus_update_after_asm, true, true);
+            set_event_hooks<UIWidgetFocusEvent>({ focus_hook, mouse_focus_update_hook });
         }
         catch(const std::runtime_error &e) {
             throw std::runtime_error("failed to initialize widget focus event: " + std::string(e.what()));
@@ -156,6 +175,9 @@ namespace Balltze::LegacyApi::Event {
         void widget_accept_event_asm();
 
         bool dispatch_widget_accept_before_event(LegacyApi::Engine::Widget *widget) {
+            if(!event_has_listeners<UIWidgetAcceptEvent>) {
+                return false;
+            }
             UIWidgetEventContext args{widget};
             UIWidgetAcceptEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -163,6 +185,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_widget_accept_after_event(LegacyApi::Engine::Widget *widget) {
+            if(!event_has_listeners<UIWidgetAcceptEvent>) {
+                return;
+            }
             UIWidgetEventContext args{widget};
             UIWidgetAcceptEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
@@ -181,13 +206,14 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *widget_accept_function_sig = Memory::get_signature("widget_accept_event_check");
+        auto *widget_accept_function_sig = Memory::get_signature(Memory::SIGNATURE_WIDGET_ACCEPT_EVENT_CHECK);
         if(!widget_accept_function_sig) {
             throw std::runtime_error("Could not find signatures for widget accept event.");
         }
 
         try {
-            Memory::hook_function(widget_accept_function_sig->data(), std::nullopt, widget_accept_event_asm, false);
+            auto *hook = Memory::hook_function(widget_accept_function_sig->data(), std::nullopt, widget_accept_event_asm, false, true);
+            set_event_hooks<UIWidgetAcceptEvent>({ hook });
         }
         catch(const std::runtime_error &e) {
             throw std::runtime_error("failed to initialize widget accept event: " + std::string(e.what()));
@@ -199,6 +225,9 @@ namespace Balltze::LegacyApi::Event {
         void *widget_sound_function_override_return;
 
         bool dispatch_widget_sound_before_event(LegacyApi::Engine::WidgetNavigationSound sound) {
+            if(!event_has_listeners<UIWidgetSoundEvent>) {
+                return false;
+            }
             UIWidgetSoundEventContext args{sound};
             UIWidgetSoundEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -206,6 +235,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_widget_sound_after_event(LegacyApi::Engine::WidgetNavigationSound sound) {
+            if(!event_has_listeners<UIWidgetSoundEvent>) {
+                return;
+            }
             UIWidgetSoundEventContext args{sound};
             UIWidgetSoundEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
@@ -224,13 +256,14 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *widget_sound_function_sig = Memory::get_signature("widget_sound_play_function");
+        auto *widget_sound_function_sig = Memory::get_signature(Memory::SIGNATURE_WIDGET_SOUND_PLAY_FUNCTION);
         if(!widget_sound_function_sig) {
             throw std::runtime_error("Could not find signatures for widget sound event.");
         }
 
         try {
-            Memory::override_function(widget_sound_function_sig->data(), widget_sound_event_asm, &widget_sound_function_override_return);
+            auto *hook = Memory::override_function(widget_sound_function_sig->data(), widget_sound_event_asm, &widget_sound_function_override_return, true);
+            set_event_hooks<UIWidgetSoundEvent>({ hook });
         }
         catch(const std::runtime_error &e) {
             throw std::runtime_error("failed to initialize widget sound event: " + std::string(e.what()));
@@ -254,6 +287,9 @@ namespace Balltze::LegacyApi::Event {
         void widget_tab_children_previous_event_after_asm();
 
         bool dispatch_widget_list_tab_before_event(LegacyApi::Engine::Widget *widget_list, UIWidgetListTabType tab_type) {
+            if(!event_has_listeners<UIWidgetListTabEvent>) {
+                return false;
+            }
             UIWidgetListTabEventContext args{widget_list, tab_type};
             UIWidgetListTabEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -261,6 +297,9 @@ namespace Balltze::LegacyApi::Event {
         }
 
         void dispatch_widget_list_tab_after_event(LegacyApi::Engine::Widget *widget_list, UIWidgetListTabType tab_type) {
+            if(!event_has_listeners<UIWidgetListTabEvent>) {
+                return;
+            }
             UIWidgetListTabEventContext args{widget_list, tab_type};
             UIWidgetListTabEvent event(EVENT_TIME_AFTER, args);
             event.dispatch();
@@ -279,13 +318,15 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
+        std::vector<Memory::Hook *> hooks;
+
         #define HOOK_FUNCTION(sig_name, event_before, event_after) \
             auto *sig_name##_sig = Memory::get_signature(#sig_name); \
             if(!sig_name##_sig) { \
                 throw std::runtime_error("Could not find signatures for widget list tab event."); \
             } \
             try { \
-                Memory::hook_function(sig_name##_sig->data(), event_before, event_after); \
+                hooks.push_back(Memory::hook_function(sig_name##_sig->data(), event_before, event_after, true, true)); \
             } \
             catch(const std::runtime_error &e) { \
                 throw std::runtime_error("failed to initialize widget list tab event: " + std::string(e.what())); \
@@ -300,12 +341,17 @@ namespace Balltze::LegacyApi::Event {
         HOOK_FUNCTION(widget_tab_children_previous_call, widget_tab_children_previous_event_before_asm, widget_tab_children_previous_event_after_asm);
 
         #undef HOOK_FUNCTION
+
+        set_event_hooks<UIWidgetListTabEvent>(std::move(hooks));
     }
 
     extern "C" {
         void handle_widget_mouse_button_press_asm();
 
         bool call_widget_mouse_button_press_events(LegacyApi::Engine::Widget *pressed_widget, LegacyApi::Engine::MouseButton button) {
+            if(!event_has_listeners<UIWidgetMouseButtonPressEvent>) {
+                return true;
+            }
             UIWidgetMouseButtonPressEventContext args{pressed_widget, button};
             UIWidgetMouseButtonPressEvent event(EVENT_TIME_BEFORE, args);
             event.dispatch();
@@ -325,7 +371,7 @@ namespace Balltze::LegacyApi::Event {
             return;
         }
 
-        auto *widget_mbc_function_sig = Memory::get_signature("widget_mouse_pressed_button_check");
+        auto *widget_mbc_function_sig = Memory::get_signature(Memory::SIGNATURE_WIDGET_MOUSE_PRESSED_BUTTON_CHECK);
         if(!widget_mbc_function_sig) {
             throw std::runtime_error("Could not find signatures for widget mouse button click event.");
         }
@@ -1,9 +1,12 @@
 // SPDX-License-Identifier: GPL-3.0-only
 
+#include <stdexcept>
 #include <balltze/api.hpp>
 #include <balltze/utils.hpp>
+#include "../../libraries/luastruct.hpp"
 #include "../../libraries/preloaded_libraries.hpp"
 #include "../../helpers/plugin.hpp"
+#include "../../../logger.hpp"
 #include "types.hpp"
 #include "api.hpp"
 
@@ -34,6 +37,36 @@ namespace Balltze::Lua::Api {
             define_ui_widget_types(state);
             define_event_types(state);
         }
+
+        /**
+         * Get the API types, defined once in a state of their own.
+         * Plugin states look them up there and only register the ones they use, instead of defining
+         * every type when they are created. The state is never closed, since plugin states keep pointers
+         * to its types.
+         */
+        static const LuastructSharedTypes *get_shared_types() noexcept {
+            static const LuastructSharedTypes *shared_types = []() -> const LuastructSharedTypes * {
+                auto *types_state = luaL_newstate();
+                if(!types_state) {
+                    return nullptr;
+                }
+                lua_pushcfunction(types_state, +[](lua_State *state) -> int {
+                    define_types(state);
+                    return 0;
+                });
+                if(lua_pcall(types_state, 0, 0, 0) != LUA_OK) {
+                    logger.error("Could not define Lua API types: {}", lua_tostring(types_state, -1));
+                    lua_close(types_state);
+                    return nullptr;
+                }
+                auto *types = luastruct_share_types(types_state);
+                if(!types) {
+                    lua_close(types_state);
+                }
+                return types;
+            }();
+            return shared_types;
+        }
     }
 
     using namespace V2;
@@ -41,7 +74,11 @@ namespace Balltze::Lua::Api {
     void open_balltze_api_v2(lua_State *state) {
         create_plugin_registry(state);
 
-        define_types(state);
+        auto *shared_types = get_shared_types();
+        if(!shared_types) {
+            throw std::runtime_error("Could not define Lua API types");
+        }
+        luastruct_use_shared_types(state, shared_types);
         
         lua_newtable(state);
         set_config_functions(state, -1);
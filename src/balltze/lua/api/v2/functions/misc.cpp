@@ -3,6 +3,7 @@
 #include <chrono>
 #include <lua.hpp>
 #include <clipboardxx/clipboardxx.hpp>
+#include "../../../helpers/allocator.hpp"
 #include "../../../helpers/function_table.hpp"
 
 namespace Balltze::Lua::Api::V2 {
@@ -106,10 +107,39 @@ namespace Balltze::Lua::Api::V2 {
         return 0;
     }
 
+    static int get_memory_stats(lua_State *state) noexcept {
+        int args = lua_gettop(state);
+        if(args != 0) {
+            return luaL_error(state, "invalid number of arguments in Balltze.misc.getMemoryStats");
+        }
+        auto *allocator = PooledAllocator::get(state);
+        if(!allocator) {
+            return luaL_error(state, "memory stats are not available for this Lua state in Balltze.misc.getMemoryStats");
+        }
+        auto stats = allocator->stats();
+        lua_newtable(state);
+        lua_pushinteger(state, stats.live_bytes);
+        lua_setfield(state, -2, "liveBytes");
+        lua_pushinteger(state, stats.peak_bytes);
+        lua_setfield(state, -2, "peakBytes");
+        lua_pushinteger(state, stats.reserved_bytes);
+        lua_setfield(state, -2, "reservedBytes");
+        lua_pushinteger(state, stats.live_allocations);
+        lua_setfield(state, -2, "liveAllocations");
+        lua_pushinteger(state, stats.allocations);
+        lua_setfield(state, -2, "allocations");
+        lua_pushinteger(state, stats.failed_allocations);
+        lua_setfield(state, -2, "failedAllocations");
+        lua_pushinteger(state, allocator->limit());
+        lua_setfield(state, -2, "limit");
+        return 1;
+    }
+
     static const luaL_Reg misc_functions[] = {
         {"createTimestamp", lua_create_timestamp},
         {"getClipboard", get_clipboard},
         {"setClipboard", set_clipboard},
+        {"getMemoryStats", get_memory_stats},
         {nullptr, nullptr}
     };
 
@@ -1,6 +1,11 @@
 // SPDX-License-Identifier: GPL-3.0-only
 
+#include <algorithm>
+#include <cstdlib>
 #include <functional>
+#include <string>
+#include <typeinfo>
+#include <vector>
 #include <lua.hpp>
 #include "../../../../events/events.hpp"
 #include "../../../../plugins/plugin.hpp"
@@ -34,16 +39,15 @@ namespace Balltze::Lua::Api::V2 {
         lua_remove(state, -2);
     }
 
-    static void get_or_create_event_listeners_table(lua_State *state, const char *name, const char *priority) noexcept {
+    static void get_or_create_event_subtable(lua_State *state, const char *name, const char *subtable_name, const char *priority) noexcept {
         get_event_table(state, name);
-        
-        const char *listeners_table_name = "listeners";
-        lua_getfield(state, -1, listeners_table_name);
+
+        lua_getfield(state, -1, subtable_name);
         if(lua_isnil(state, -1)) {
             lua_pop(state, 1);
             lua_newtable(state);
-            lua_setfield(state, -2, listeners_table_name);
-            lua_getfield(state, -1, listeners_table_name);
+            lua_setfield(state, -2, subtable_name);
+            lua_getfield(state, -1, subtable_name);
         }
         lua_remove(state, -2);
 
@@ -57,6 +61,68 @@ namespace Balltze::Lua::Api::V2 {
         lua_remove(state, -2); 
     }
 
+    static void get_or_create_event_listeners_table(lua_State *state, const char *name, const char *priority) noexcept {
+        get_or_create_event_subtable(state, name, "listeners", priority);
+    }
+
+    /**
+     * Push the listeners of an event priority as a sequence, or nil if there are none.
+     * The sequence is rebuilt every time a listener is added or removed, so a dispatch can walk it
+     * without allocating anything.
+     */
+    static void get_event_listeners_array(lua_State *state, const char *name, const char *priority) noexcept {
+        get_event_table(state, name);
+        if(lua_isnil(state, -1)) {
+            return;
+        }
+        lua_getfield(state, -1, "arrays");
+        lua_remove(state, -2);
+        if(lua_isnil(state, -1)) {
+            return;
+        }
+        lua_getfield(state, -1, priority);
+        lua_remove(state, -2);
+    }
+
+    /**
+     * Rebuild the listeners sequence of an event priority from its listeners table, in subscription order.
+     * The old sequence is replaced rather than changed, so a dispatch that is walking it is not affected.
+     */
+    static void rebuild_event_listeners_array(lua_State *state, const char *name, const char *priority) noexcept {
+        get_or_create_event_listeners_table(state, name, priority);
+        std::vector<lua_Integer> handles;
+        lua_pushnil(state);
+        while(lua_next(state, -2)) {
+            if(lua_isfunction(state, -1)) {
+                handles.push_back(std::strtoll(lua_tostring(state, -2), nullptr, 10));
+            }
+            else {
+                logger.error("Invalid event listener in Balltze.events.{}: expected function, got {}.", name, lua_typename(state, lua_type(state, -1)));
+            }
+            lua_pop(state, 1);
+        }
+        std::sort(handles.begin(), handles.end());
+
+        get_event_table(state, name);
+        lua_getfield(state, -1, "arrays");
+        if(lua_isnil(state, -1)) {
+            lua_pop(state, 1);
+            lua_newtable(state);
+            lua_pushvalue(state, -1);
+            lua_setfield(state, -3, "arrays");
+        }
+        lua_remove(state, -2);
+
+        lua_createtable(state, handles.size(), 0);
+        for(std::size_t i = 0; i < handles.size(); i++) {
+            auto handle = std::to_string(handles[i]);
+            lua_getfield(state, -3, handle.c_str());
+            lua_rawseti(state, -2, i + 1);
+        }
+        lua_setfield(state, -2, priority);
+        lua_pop(state, 2);
+    }
+
     static std::size_t get_event_listeners_count(lua_State *state, const char *name) noexcept {
         get_event_table(state, name);
         lua_getfield(state, -1, "listenersCount");
@@ -65,16 +131,25 @@ namespace Balltze::Lua::Api::V2 {
         return count;
     }
 
+    static void set_event_listeners_count(lua_State *state, const char *name, std::size_t count) noexcept {
+        get_event_table(state, name);
+        lua_pushinteger(state, count);
+        lua_setfield(state, -2, "listenersCount");
+        lua_pop(state, 1);
+    }
+
     static int add_event_listener(lua_State *state, const char *name, int function_index, EventPriority priority) noexcept {
         if(lua_isfunction(state, function_index)) {
             auto priority_name = event_priority_to_string(priority);
             get_or_create_event_listeners_table(state, name, priority_name);
 
-            // Push function to the priority table
+            // Push function to the priority table; handles are never reused
             auto listeners_count = get_event_listeners_count(state, name);
             auto handle = std::to_string(listeners_count + 1);
+            set_event_listeners_count(state, name, listeners_count + 1);
             lua_pushvalue(state, function_index);
             lua_setfield(state, -2, handle.c_str());
+            rebuild_event_listeners_array(state, name, priority_name);
 
             // Create listener handle
             lua_newtable(state);
@@ -87,11 +162,14 @@ namespace Balltze::Lua::Api::V2 {
 
             lua_pushvalue(state, -2); // listeners table
             lua_pushstring(state, handle.c_str());
+            lua_pushstring(state, name);
+            lua_pushstring(state, priority_name);
             lua_pushcclosure(state, +[](lua_State *state) -> int {
                 lua_pushnil(state);
                 lua_setfield(state, lua_upvalueindex(1), luaL_checkstring(state, lua_upvalueindex(2)));
+                rebuild_event_listeners_array(state, lua_tostring(state, lua_upvalueindex(3)), lua_tostring(state, lua_upvalueindex(4)));
                 return 0;
-            }, 2);
+            }, 4);
             lua_setfield(state, -2, "remove");
 
             lua_remove(state, -2); // Remove the listener table from the stack
@@ -107,6 +185,8 @@ namespace Balltze::Lua::Api::V2 {
         get_event_table(state, name);
         lua_pushnil(state);
         lua_setfield(state, -2, "listeners");
+        lua_pushnil(state);
+        lua_setfield(state, -2, "arrays");
         lua_pop(state, 1);
     }
 
@@ -137,22 +217,28 @@ namespace Balltze::Lua::Api::V2 {
         lua_setfield(state, -2, "cancel");
     }
 
-    void call_events_by_priority(lua_State *state, const char *name, EventPriority priority, std::function<void(lua_State *)> create_event_object) noexcept {
-        auto priority_name = event_priority_to_string(priority);
-        get_or_create_event_listeners_table(state, name, priority_name);
-
-        // Get all event listeners
-        lua_newtable(state);
-        lua_pushnil(state);
-        while(lua_next(state, -3)) {
-            if(lua_isfunction(state, -1)) {
-                lua_pushvalue(state, -1);
-                lua_rawseti(state, -4, lua_rawlen(state, -4) + 1);
-            }
-            else {
-                logger.error("Invalid event listener in Balltze.events.{}: expected function, got {}.", name, lua_typename(state, lua_type(state, -1)));
+    static void call_event_listeners(lua_State *state, const char *name, int size) noexcept {
+        for(int i = 1; i <= size; i++) {
+            lua_pushcfunction(state, plugin_error_handler);
+            lua_rawgeti(state, -3, i);
+            lua_pushvalue(state, -3); 
+            int res = lua_pcall(state, 1, 0, -3);
+            if(res != LUA_OK) {
+                logger.error("Error in event listener in Balltze.events.{}: {}.", name, lua_tostring(state, -1));
+                lua_pop(state, 1);
             }
+            lua_pop(state, 1); // error handler
+        }
+    }
+
+    void call_events_by_priority(Plugins::LuaPlugin *plugin, const std::type_info &event_type, const char *name, EventPriority priority, std::function<void(lua_State *)> create_event_object) noexcept {
+        auto *state = plugin->lua_state();
+        auto priority_name = event_priority_to_string(priority);
+        get_event_listeners_array(state, name, priority_name);
+        int size = lua_istable(state, -1) ? lua_rawlen(state, -1) : 0;
+        if(size == 0) {
             lua_pop(state, 1);
+            return;
         }
 
         if(create_event_object) {
@@ -162,20 +248,18 @@ namespace Balltze::Lua::Api::V2 {
             lua_pushnil(state);
         }
 
-        // Call all event listeners
-        int size = lua_rawlen(state, -2);
-        for(int i = 1; i <= size; i++) {
-            lua_pushcfunction(state, plugin_error_handler);
-            lua_rawgeti(state, -3, i);
-            lua_pushvalue(state, -3); 
-            int res = lua_pcall(state, 1, 0, -3);
-            if(res != LUA_OK) {
-                logger.error("Error in event listener in Balltze.events.{}: {}.", name, lua_tostring(state, -1));
-                lua_pop(state, 1);
-            }
+        // Call all event listeners, timing them under the plugin if profiling is enabled
+        if(listener_profiling_enabled) {
+            auto *profile = get_lua_listener_profile(event_type, plugin->name());
+            time_listener_call(profile, [&]() {
+                call_event_listeners(state, name, size);
+            });
+        }
+        else {
+            call_event_listeners(state, name, size);
         }
         
-        lua_pop(state, 3);
+        lua_pop(state, 2);
     };
 
     int lua_event_add_listener(lua_State *state) noexcept {
@@ -225,8 +309,7 @@ namespace Balltze::Lua::Api::V2 {
             auto plugins = Plugins::get_lua_plugins(); \
             for(auto *&plugin : plugins) { \
                 if(plugin->loaded()) { \
-                    auto *state = plugin->lua_state(); \
-                    call_events_by_priority(state, #event_name, priority, nullptr); \
+                    call_events_by_priority(plugin, typeid(Event), #event_name, priority, nullptr); \
                 } \
             } \
         }
@@ -236,8 +319,7 @@ namespace Balltze::Lua::Api::V2 {
             auto plugins = Plugins::get_lua_plugins(); \
             for(auto *&plugin : plugins) { \
                 if(plugin->loaded()) { \
-                    auto *state = plugin->lua_state(); \
-                    call_events_by_priority(state, #event_name, priority, [&](lua_State *state) { \
+                    call_events_by_priority(plugin, typeid(Event), #event_name, priority, [&](lua_State *state) { \
                         push_function(state, event); \
                     }); \
                 } \
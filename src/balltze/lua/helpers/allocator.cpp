@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include "allocator.hpp"
+
+namespace Balltze::Lua {
+    void *PooledAllocator::allocate(void *allocator, void *block, std::size_t old_size, std::size_t new_size) noexcept {
+        auto *pooled_allocator = static_cast<PooledAllocator *>(allocator);
+        auto lock = pooled_allocator->lock();
+        return pooled_allocator->reallocate(block, old_size, new_size);
+    }
+
+    PooledAllocator *PooledAllocator::get(lua_State *state) noexcept {
+        void *allocator;
+        if(lua_getallocf(state, &allocator) != allocate) {
+            return nullptr;
+        }
+        return static_cast<PooledAllocator *>(allocator);
+    }
+
+    LuaMemoryStats PooledAllocator::stats() noexcept {
+        auto lock = this->lock();
+        return m_stats;
+    }
+
+    std::size_t PooledAllocator::limit() const noexcept {
+        return m_limit;
+    }
+
+    void PooledAllocator::set_limit(std::size_t limit) noexcept {
+        auto lock = this->lock();
+        m_limit = limit;
+    }
+
+    void PooledAllocator::share() noexcept {
+        m_shared = true;
+    }
+
+    PooledAllocator::~PooledAllocator() {
+        for(auto *chunk : m_chunks) {
+            std::free(chunk);
+        }
+    }
+
+    void *PooledAllocator::allocate_block(std::size_t size) noexcept {
+        if(size > LUA_ALLOCATOR_MAX_POOLED_SIZE) {
+            auto *block = std::malloc(size);
+            if(block) {
+                m_stats.reserved_bytes += size;
+            }
+            return block;
+        }
+
+        auto size_class_index = size_class(size);
+        if(auto *block = m_free_lists[size_class_index]) {
+            m_free_lists[size_class_index] = block->next;
+            return block;
+        }
+
+        std::size_t block_size = (size_class_index + 1) * LUA_ALLOCATOR_GRANULARITY;
+        if(static_cast<std::size_t>(m_chunk_end - m_chunk_cursor) < block_size) {
+            auto *chunk = static_cast<std::byte *>(std::malloc(LUA_ALLOCATOR_CHUNK_SIZE));
+            if(!chunk) {
+                return nullptr;
+            }
+            try {
+                m_chunks.push_back(chunk);
+            }
+            catch(std::bad_alloc &) {
+                std::free(chunk);
+                return nullptr;
+            }
+            m_stats.reserved_bytes += LUA_ALLOCATOR_CHUNK_SIZE;
+
+            // Hand the rest of the previous chunk to the free list that fits it
+            std::size_t leftover = m_chunk_end - m_chunk_cursor;
+            if(leftover >= LUA_ALLOCATOR_GRANULARITY) {
+                free_block(m_chunk_cursor, leftover);
+            }
+            m_chunk_cursor = chunk;
+            m_chunk_end = chunk + LUA_ALLOCATOR_CHUNK_SIZE;
+        }
+
+        auto *block = m_chunk_cursor;
+        m_chunk_cursor += block_size;
+        return block;
+    }
+
+    void PooledAllocator::free_block(void *block, std::size_t size) noexcept {
+        if(size > LUA_ALLOCATOR_MAX_POOLED_SIZE) {
+            std::free(block);
+            m_stats.reserved_bytes -= size;
+            return;
+        }
+        auto size_class_index = size_class(size);
+        auto *free_block = static_cast<FreeBlock *>(block);
+        free_block->next = m_free_lists[size_class_index];
+        m_free_lists[size_class_index] = free_block;
+    }
+
+    void *PooledAllocator::reallocate(void *block, std::size_t old_size, std::size_t new_size) noexcept {
+        // Without a block, Lua passes the type of the object to allocate as the old size
+        if(!block) {
+            old_size = 0;
+        }
+
+        if(new_size == 0) {
+            if(block) {
+                free_block(block, old_size);
+                m_stats.live_bytes -= old_size;
+                m_stats.live_allocations--;
+            }
+            return nullptr;
+        }
+
+        if(new_size > old_size && m_limit != 0 && m_stats.live_bytes - old_size + new_size > m_limit) {
+            m_stats.failed_allocations++;
+            return nullptr;
+        }
+
+        void *new_block;
+        bool old_pooled = old_size <= LUA_ALLOCATOR_MAX_POOLED_SIZE;
+        bool new_pooled = new_size <= LUA_ALLOCATOR_MAX_POOLED_SIZE;
+        if(block && old_pooled && new_pooled && size_class(old_size) == size_class(new_size)) {
+            new_block = block;
+        }
+        else if(block && !old_pooled && !new_pooled) {
+            new_block = std::realloc(block, new_size);
+            if(!new_block) {
+                m_stats.failed_allocations++;
+                return nullptr;
+            }
+            m_stats.reserved_bytes += new_size;
+            m_stats.reserved_bytes -= old_size;
+        }
+        else {
+            new_block = allocate_block(new_size);
+            if(!new_block) {
+                m_stats.failed_allocations++;
+                return nullptr;
+            }
+            if(block) {
+                std::memcpy(new_block, block, std::min<std::size_t>(old_size, new_size));
+                free_block(block, old_size);
+            }
+        }
+
+        if(!block) {
+            m_stats.live_allocations++;
+            m_stats.allocations++;
+        }
+        m_stats.live_bytes += new_size;
+        m_stats.live_bytes -= old_size;
+        m_stats.peak_bytes = std::max<std::size_t>(m_stats.peak_bytes, m_stats.live_bytes);
+        return new_block;
+    }
+}
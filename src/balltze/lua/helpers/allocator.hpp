@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__LUA__HELPERS__ALLOCATOR_HPP
+#define BALLTZE__LUA__HELPERS__ALLOCATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <lua.hpp>
+
+#define LUA_ALLOCATOR_GRANULARITY 8
+#define LUA_ALLOCATOR_MAX_POOLED_SIZE 256
+#define LUA_ALLOCATOR_CHUNK_SIZE (64 * 1024)
+
+namespace Balltze::Lua {
+    /**
+     * Memory usage of a Lua state
+     */
+    struct LuaMemoryStats {
+        /** Bytes in use by the state */
+        std::size_t live_bytes = 0;
+
+        /** Highest value of live_bytes */
+        std::size_t peak_bytes = 0;
+
+        /** Bytes taken from the CRT heap: pool chunks and blocks too big for the pools */
+        std::size_t reserved_bytes = 0;
+
+        /** Blocks in use by the state */
+        std::size_t live_allocations = 0;
+
+        /** Blocks allocated since the state was created */
+        std::uint64_t allocations = 0;
+
+        /** Allocations refused because of the memory limit or because the heap ran out */
+        std::uint64_t failed_allocations = 0;
+    };
+
+    /**
+     * Lua allocator that serves small blocks from size-class free lists owned by a single state.
+     * Small tables, strings and closures are carved out of big chunks instead of going one by one through the
+     * CRT heap, which is shared by every plugin and fragments quickly; the chunks are freed with the
+     * allocator. Blocks bigger than LUA_ALLOCATOR_MAX_POOLED_SIZE go straight to the CRT heap.
+     * Calls are only serialized once the allocator is shared, since Lanes creates lane states with the allocator
+     * of the state that loads it; states that never load Lanes are only used from the game thread.
+     */
+    class PooledAllocator {
+    public:
+        /**
+         * Allocation function to give to lua_newstate, with the allocator as user data
+         */
+        static void *allocate(void *allocator, void *block, std::size_t old_size, std::size_t new_size) noexcept;
+
+        /**
+         * Get the allocator of a Lua state
+         * @param state     Lua state
+         * @return          Allocator of the state, or nullptr if the state uses another allocation function
+         */
+        static PooledAllocator *get(lua_State *state) noexcept;
+
+        /**
+         * Get the memory usage of the state
+         */
+        LuaMemoryStats stats() noexcept;
+
+        /**
+         * Get the memory limit
+         * @return  Most bytes the state can use; 0 if there is no limit
+         */
+        std::size_t limit() const noexcept;
+
+        /**
+         * Set the memory limit; allocations that would go over it fail, so Lua collects garbage and then raises
+         * a memory error. Blocks that are already allocated are kept.
+         * @param limit     Most bytes the state can use; 0 for no limit
+         */
+        void set_limit(std::size_t limit) noexcept;
+
+        /**
+         * Serialize every call from now on. Must be called from the thread using the state, before any other
+         * thread can get to the allocator.
+         */
+        void share() noexcept;
+
+        PooledAllocator(std::size_t limit = 0) noexcept : m_limit(limit) {}
+        PooledAllocator(const PooledAllocator &) = delete;
+        PooledAllocator &operator=(const PooledAllocator &) = delete;
+        ~PooledAllocator();
+
+    private:
+        static constexpr std::size_t size_class_count = LUA_ALLOCATOR_MAX_POOLED_SIZE / LUA_ALLOCATOR_GRANULARITY;
+
+        struct FreeBlock {
+            FreeBlock *next;
+        };
+
+        /** Free blocks of every size class */
+        std::array<FreeBlock *, size_class_count> m_free_lists = {};
+
+        /** Chunks the pooled blocks are carved from */
+        std::vector<std::byte *> m_chunks;
+
+        /** Unused space of the last chunk */
+        std::byte *m_chunk_cursor = nullptr;
+        std::byte *m_chunk_end = nullptr;
+
+        std::size_t m_limit;
+        LuaMemoryStats m_stats;
+
+        /** Locked by every call once the allocator is shared */
+        std::mutex m_mutex;
+        bool m_shared = false;
+
+        std::unique_lock<std::mutex> lock() noexcept {
+            return m_shared ? std::unique_lock<std::mutex>(m_mutex) : std::unique_lock<std::mutex>();
+        }
+
+        static std::size_t size_class(std::size_t size) noexcept {
+            return (size - 1) / LUA_ALLOCATOR_GRANULARITY;
+        }
+
+        void *allocate_block(std::size_t size) noexcept;
+        void free_block(void *block, std::size_t size) noexcept;
+        void *reallocate(void *block, std::size_t old_size, std::size_t new_size) noexcept;
+    };
+}
+
+#endif
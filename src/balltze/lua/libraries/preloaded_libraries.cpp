@@ -4,6 +4,7 @@
 #include <balltze/helpers/resources.hpp>
 #include <balltze/utils.hpp>
 #include "../../resources.hpp"
+#include "../helpers/allocator.hpp"
 #include "lanes.hpp"
 #include "lfmt.hpp"
 
@@ -22,7 +23,7 @@ namespace Balltze::Lua {
     static int lua_open_json(lua_State *state) noexcept {
         auto json_module_data = load_resource_data(get_current_module(), MAKEINTRESOURCEW(ID_LUA_JSON_MODULE), L"LUA");
         if(json_module_data) {
-            if(luaL_loadbufferx(state, reinterpret_cast<const char *>(json_module_data->data()), json_module_data->size(), "json", "t") == LUA_OK) {
+            if(luaL_loadbufferx(state, reinterpret_cast<const char *>(json_module_data->data()), json_module_data->size(), "json", "b") == LUA_OK) {
                 lua_call(state, 0, 1);
                 return 1;
             }
@@ -33,7 +34,7 @@ namespace Balltze::Lua {
     static int lua_open_luna(lua_State *state) noexcept {
         auto luna_module_data = load_resource_data(get_current_module(), MAKEINTRESOURCEW(ID_LUA_LUNA_MODULE), L"LUA");
         if(luna_module_data) {
-            if(luaL_loadbufferx(state, reinterpret_cast<const char *>(luna_module_data->data()), luna_module_data->size(), "luna", "t") == LUA_OK) {
+            if(luaL_loadbufferx(state, reinterpret_cast<const char *>(luna_module_data->data()), luna_module_data->size(), "luna", "b") == LUA_OK) {
                 lua_call(state, 0, 1);
                 return 1;
             }
@@ -44,7 +45,7 @@ namespace Balltze::Lua {
     static int lua_open_inspect(lua_State *state) noexcept {
         auto inspect_module_data = load_resource_data(get_current_module(), MAKEINTRESOURCEW(ID_LUA_INSPECT_MODULE), L"LUA");
         if(inspect_module_data) {
-            if(luaL_loadbufferx(state, reinterpret_cast<const char *>(inspect_module_data->data()), inspect_module_data->size(), "inspect", "t") == LUA_OK) {
+            if(luaL_loadbufferx(state, reinterpret_cast<const char *>(inspect_module_data->data()), inspect_module_data->size(), "inspect", "b") == LUA_OK) {
                 lua_call(state, 0, 1);
                 return 1;
             }
@@ -55,7 +56,7 @@ namespace Balltze::Lua {
     int lua_open_lanes(lua_State *state) noexcept {
         auto lanes_module_data = load_resource_data(get_current_module(), MAKEINTRESOURCEW(ID_LUA_LANES_MODULE), L"LUA");
         if(lanes_module_data) {
-            if(luaL_loadbufferx(state, reinterpret_cast<const char *>(lanes_module_data->data()), lanes_module_data->size(), "lanes", "t") == LUA_OK) {
+            if(luaL_loadbufferx(state, reinterpret_cast<const char *>(lanes_module_data->data()), lanes_module_data->size(), "lanes", "b") == LUA_OK) {
                 lua_call(state, 0, 1);
                 return 1;
             }
@@ -63,6 +64,17 @@ namespace Balltze::Lua {
         return 0;
     }
 
+    static int lua_open_configured_lanes(lua_State *state) noexcept {
+        // Lane states are created with the allocator of this one, from their own threads
+        if(auto *allocator = PooledAllocator::get(state)) {
+            allocator->share();
+        }
+        luaopen_lanes_embedded(state, lua_open_lanes);
+        lua_getfield(state, -1, "configure");
+        lua_call(state, 0, 0);
+        return 1;
+    }
+
     void set_preloaded_libraries(lua_State *state) noexcept {
         lua_getglobal(state, "package");
         lua_getfield(state, -1, "preload");
@@ -80,11 +92,9 @@ namespace Balltze::Lua {
         lua_pushcfunction(state, lua_open_inspect);
         lua_setfield(state, preload_table_index, "inspect");
 
-        // Preload and configure lanes 
-        luaopen_lanes_embedded(state, lua_open_lanes);
-        lua_getfield(state, -1, "configure");
-        lua_call(state, 0, 0);
-        lua_pop(state, 1);
+        // Lanes starts its keeper states when configured, so only do it for the plugins that use it
+        lua_pushcfunction(state, lua_open_configured_lanes);
+        lua_setfield(state, preload_table_index, "lanes");
 
         lua_pop(state, 2);
     }
@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <cstring>
+#include <stdexcept>
+#include "byte_pattern.hpp"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    #include <immintrin.h>
+    #define BYTE_PATTERN_SIMD
+#endif
+
+namespace Balltze::Memory {
+    BytePattern::BytePattern(const short *pattern, std::size_t length) {
+        if(length == 0) {
+            throw std::invalid_argument("Empty signature");
+        }
+
+        m_values.reserve(length);
+        m_mask.reserve(length);
+        for(std::size_t i = 0; i < length; i++) {
+            if(pattern[i] == -1) {
+                m_values.push_back(0x00);
+                m_mask.push_back(0x00);
+            }
+            else if(pattern[i] >= 0 && pattern[i] <= 0xFF) {
+                m_values.push_back(static_cast<std::uint8_t>(pattern[i]));
+                m_mask.push_back(0xFF);
+                if(!m_first) {
+                    m_first = i;
+                }
+                m_last = i;
+            }
+            else {
+                throw std::invalid_argument("Invalid signature");
+            }
+        }
+    }
+
+    BytePattern::BytePattern(const std::uint8_t *values, const std::uint8_t *mask, std::size_t length) {
+        if(length == 0) {
+            throw std::invalid_argument("Empty signature");
+        }
+
+        m_values.reserve(length);
+        m_mask.reserve(length);
+        for(std::size_t i = 0; i < length; i++) {
+            if(mask[i] == 0x00) {
+                m_values.push_back(0x00);
+                m_mask.push_back(0x00);
+            }
+            else if(mask[i] == 0xFF) {
+                m_values.push_back(values[i]);
+                m_mask.push_back(0xFF);
+                if(!m_first) {
+                    m_first = i;
+                }
+                m_last = i;
+            }
+            else {
+                throw std::invalid_argument("Invalid signature mask");
+            }
+        }
+    }
+
+    /**
+     * Check the start positions in [begin, end]. memchr finds the candidates where the first fixed byte
+     * of the pattern matches, and only those are compared against the rest of the pattern.
+     */
+    static void find_scalar(const BytePattern &pattern, const std::uint8_t *memory, std::size_t begin, std::size_t end, std::vector<std::size_t> &offsets, std::size_t limit) noexcept {
+        auto anchor = pattern.anchor();
+        if(!anchor) {
+            for(std::size_t i = begin; i <= end; i++) {
+                offsets.push_back(i);
+                if(offsets.size() >= limit) {
+                    return;
+                }
+            }
+            return;
+        }
+
+        auto first = *anchor;
+        auto first_byte = pattern.values()[first];
+        std::size_t i = begin;
+        while(i <= end) {
+            auto *candidate = static_cast<const std::uint8_t *>(std::memchr(memory + i + first, first_byte, end - i + 1));
+            if(!candidate) {
+                return;
+            }
+            i = candidate - memory - first;
+            if(pattern.matches_at(memory + i)) {
+                offsets.push_back(i);
+                if(offsets.size() >= limit) {
+                    return;
+                }
+            }
+            i++;
+        }
+    }
+
+#ifdef BYTE_PATTERN_SIMD
+    /**
+     * The SIMD matchers compare the first and last fixed bytes of the pattern against a whole
+     * vector of start positions at once, and only check the full pattern on the candidates
+     * where both of them match.
+     */
+    __attribute__((target("sse2")))
+    static void find_sse2(const BytePattern &pattern, const std::uint8_t *memory, std::size_t end, std::size_t first, std::size_t last, std::vector<std::size_t> &offsets, std::size_t limit) noexcept {
+        auto first_byte = _mm_set1_epi8(static_cast<char>(pattern.values()[first]));
+        auto last_byte = _mm_set1_epi8(static_cast<char>(pattern.values()[last]));
+
+        std::size_t i = 0;
+        for(; end >= 15 && i <= end - 15; i += 16) {
+            auto block_first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(memory + i + first));
+            auto block_last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(memory + i + last));
+            auto eq = _mm_and_si128(_mm_cmpeq_epi8(first_byte, block_first), _mm_cmpeq_epi8(last_byte, block_last));
+            auto bits = static_cast<std::uint32_t>(_mm_movemask_epi8(eq));
+            while(bits != 0) {
+                auto position = i + __builtin_ctz(bits);
+                if(pattern.matches_at(memory + position)) {
+                    offsets.push_back(position);
+                    if(offsets.size() >= limit) {
+                        return;
+                    }
+                }
+                bits &= bits - 1;
+            }
+        }
+        find_scalar(pattern, memory, i, end, offsets, limit);
+    }
+
+    __attribute__((target("avx2")))
+    static void find_avx2(const BytePattern &pattern, const std::uint8_t *memory, std::size_t end, std::size_t first, std::size_t last, std::vector<std::size_t> &offsets, std::size_t limit) noexcept {
+        auto first_byte = _mm256_set1_epi8(static_cast<char>(pattern.values()[first]));
+        auto last_byte = _mm256_set1_epi8(static_cast<char>(pattern.values()[last]));
+
+        std::size_t i = 0;
+        for(; end >= 31 && i <= end - 31; i += 32) {
+            auto block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(memory + i + first));
+            auto block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(memory + i + last));
+            auto eq = _mm256_and_si256(_mm256_cmpeq_epi8(first_byte, block_first), _mm256_cmpeq_epi8(last_byte, block_last));
+            auto bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(eq));
+            while(bits != 0) {
+                auto position = i + __builtin_ctz(bits);
+                if(pattern.matches_at(memory + position)) {
+                    offsets.push_back(position);
+                    if(offsets.size() >= limit) {
+                        return;
+                    }
+                }
+                bits &= bits - 1;
+            }
+        }
+        find_scalar(pattern, memory, i, end, offsets, limit);
+    }
+#endif
+
+    BytePatternMatcher BytePattern::best_matcher() noexcept {
+#ifdef BYTE_PATTERN_SIMD
+        static BytePatternMatcher matcher = []() {
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx2")) {
+                return BYTE_PATTERN_MATCHER_AVX2;
+            }
+            if(__builtin_cpu_supports("sse2")) {
+                return BYTE_PATTERN_MATCHER_SSE2;
+            }
+            return BYTE_PATTERN_MATCHER_SCALAR;
+        }();
+        return matcher;
+#else
+        return BYTE_PATTERN_MATCHER_SCALAR;
+#endif
+    }
+
+    void BytePattern::find(const std::byte *memory, std::size_t length, std::vector<std::size_t> &offsets, std::size_t limit, BytePatternMatcher matcher) const noexcept {
+        if(length < size() || limit == 0) {
+            return;
+        }
+
+        auto *bytes = reinterpret_cast<const std::uint8_t *>(memory);
+        auto end = length - size();
+
+        if(matcher == BYTE_PATTERN_MATCHER_AUTO) {
+            matcher = best_matcher();
+        }
+
+        // Patterns made only of wildcards have nothing to vectorize
+        if(!m_first) {
+            matcher = BYTE_PATTERN_MATCHER_SCALAR;
+        }
+
+        switch(matcher) {
+#ifdef BYTE_PATTERN_SIMD
+            case BYTE_PATTERN_MATCHER_AVX2:
+                find_avx2(*this, bytes, end, *m_first, m_last, offsets, limit);
+                break;
+            case BYTE_PATTERN_MATCHER_SSE2:
+                find_sse2(*this, bytes, end, *m_first, m_last, offsets, limit);
+                break;
+#endif
+            default:
+                find_scalar(*this, bytes, 0, end, offsets, limit);
+                break;
+        }
+    }
+}
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__MEMORY__BYTE_PATTERN_HPP
+#define BALLTZE__MEMORY__BYTE_PATTERN_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace Balltze::Memory {
+    enum BytePatternMatcher {
+        BYTE_PATTERN_MATCHER_AUTO,
+        BYTE_PATTERN_MATCHER_SCALAR,
+        BYTE_PATTERN_MATCHER_SSE2,
+        BYTE_PATTERN_MATCHER_AVX2
+    };
+
+    /**
+     * Byte pattern with wildcards, stored as value/mask pairs.
+     */
+    class BytePattern {
+    public:
+        /**
+         * Get the pattern size
+         */
+        std::size_t size() const noexcept {
+            return m_values.size();
+        }
+
+        /**
+         * Get the position of the first byte that is not a wildcard
+         */
+        std::optional<std::size_t> anchor() const noexcept {
+            return m_first;
+        }
+
+        /**
+         * Get the pattern values; wildcard positions are zero
+         */
+        const std::uint8_t *values() const noexcept {
+            return m_values.data();
+        }
+
+        /**
+         * Get the pattern mask; 0xFF for bytes that must match and 0x00 for wildcards
+         */
+        const std::uint8_t *mask() const noexcept {
+            return m_mask.data();
+        }
+
+        /**
+         * Check if the pattern matches the given memory
+         * @param memory    Memory to compare; must have at least size() bytes
+         */
+        bool matches_at(const std::uint8_t *memory) const noexcept {
+            for(std::size_t i = 0; i < m_values.size(); i++) {
+                if((memory[i] & m_mask[i]) != m_values[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Find the pattern in a memory block
+         * @param memory    Memory to scan
+         * @param length    Size of the memory
+         * @param offsets   Offsets of the matches from the start of the memory
+         * @param limit     Stop after this many matches
+         * @param matcher   Matcher implementation; the best one supported by the CPU is used by default
+         */
+        void find(const std::byte *memory, std::size_t length, std::vector<std::size_t> &offsets, std::size_t limit = std::numeric_limits<std::size_t>::max(), BytePatternMatcher matcher = BYTE_PATTERN_MATCHER_AUTO) const noexcept;
+
+        /**
+         * Get the best matcher supported by the CPU
+         */
+        static BytePatternMatcher best_matcher() noexcept;
+
+        /**
+         * Constructor for BytePattern
+         * @param pattern   Pattern bytes; -1 is a wildcard
+         * @param length    Number of bytes
+         * @throws std::invalid_argument if the pattern is empty or has invalid bytes
+         */
+        BytePattern(const short *pattern, std::size_t length);
+
+        /**
+         * Constructor for BytePattern
+         * @param values    Bytes to match
+         * @param mask      Match mask; 0xFF for bytes that must match and 0x00 for wildcards
+         * @param length    Number of bytes
+         * @throws std::invalid_argument if the pattern is empty or has invalid mask bytes
+         */
+        BytePattern(const std::uint8_t *values, const std::uint8_t *mask, std::size_t length);
+
+    private:
+        /** Bytes to match */
+        std::vector<std::uint8_t> m_values;
+
+        /** Match mask */
+        std::vector<std::uint8_t> m_mask;
+
+        /** Position of the first non-wildcard byte */
+        std::optional<std::size_t> m_first;
+
+        /** Position of the last non-wildcard byte */
+        std::size_t m_last = 0;
+    };
+}
+
+#endif
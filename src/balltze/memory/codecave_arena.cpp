@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <windows.h>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+#include "../logger.hpp"
+#include "codecave_arena.hpp"
+
+#define CODECAVE_SLAB_SIZE 0x10000
+#define CODECAVE_ALIGNMENT 16
+#define CODECAVE_SLAB_SEARCH_RANGE 0x10000000
+
+namespace Balltze::Memory {
+    struct CodecaveArena {
+        std::byte *slab_top = nullptr;
+        std::byte *slab_end = nullptr;
+
+        /** Freed slab caves by aligned size */
+        std::map<std::size_t, std::vector<std::byte *>> free_caves;
+
+        std::mutex mutex;
+    };
+
+    /**
+     * Get the arena; it is never destroyed, since hooks free their caves during static destruction.
+     */
+    static CodecaveArena &arena() noexcept {
+        static auto *arena = new CodecaveArena();
+        return *arena;
+    }
+
+    static std::size_t aligned_cave_size(std::size_t size) noexcept {
+        return (std::max<std::size_t>(size, 1) + CODECAVE_ALIGNMENT - 1) / CODECAVE_ALIGNMENT * CODECAVE_ALIGNMENT;
+    }
+
+    /**
+     * Reserve executable memory in the first free region after the game executable, so caves stay
+     * close to the code that jumps into them.
+     */
+    static std::byte *reserve_slab(std::size_t size) noexcept {
+        SYSTEM_INFO system_info;
+        GetSystemInfo(&system_info);
+        std::uintptr_t granularity = system_info.dwAllocationGranularity;
+
+        auto *module = reinterpret_cast<std::byte *>(GetModuleHandle(0));
+        auto *dos_header = reinterpret_cast<PIMAGE_DOS_HEADER>(module);
+        auto *nt_headers = reinterpret_cast<PIMAGE_NT_HEADERS>(module + dos_header->e_lfanew);
+        auto address = reinterpret_cast<std::uintptr_t>(module) + nt_headers->OptionalHeader.SizeOfImage;
+        auto search_end = address + CODECAVE_SLAB_SEARCH_RANGE;
+
+        while(address < search_end) {
+            address = (address + granularity - 1) / granularity * granularity;
+
+            MEMORY_BASIC_INFORMATION info;
+            if(VirtualQuery(reinterpret_cast<void *>(address), &info, sizeof(info)) == 0) {
+                break;
+            }
+
+            auto region_end = reinterpret_cast<std::uintptr_t>(info.BaseAddress) + info.RegionSize;
+            if(info.State == MEM_FREE && region_end - address >= size) {
+                auto *slab = VirtualAlloc(reinterpret_cast<void *>(address), size, MEM_RESERVE | MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+                if(slab) {
+                    return reinterpret_cast<std::byte *>(slab);
+                }
+            }
+            address = region_end;
+        }
+
+        // Anywhere will do; a rel32 jump reaches the whole address space
+        return reinterpret_cast<std::byte *>(VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_EXECUTE_READWRITE));
+    }
+
+    std::byte *allocate_codecave(std::size_t size) noexcept {
+        auto &arena = Memory::arena();
+        std::lock_guard<std::mutex> lock(arena.mutex);
+
+        size = aligned_cave_size(size);
+
+        // Big caves get their own region instead of wasting the rest of the slab
+        if(size > CODECAVE_SLAB_SIZE / 4) {
+            return reserve_slab(size);
+        }
+
+        auto free_caves = arena.free_caves.find(size);
+        if(free_caves != arena.free_caves.end() && !free_caves->second.empty()) {
+            auto *cave = free_caves->second.back();
+            free_caves->second.pop_back();
+            return cave;
+        }
+
+        if(!arena.slab_top || static_cast<std::size_t>(arena.slab_end - arena.slab_top) < size) {
+            auto *slab = reserve_slab(CODECAVE_SLAB_SIZE);
+            if(!slab) {
+                return nullptr;
+            }
+            arena.slab_top = slab;
+            arena.slab_end = slab + CODECAVE_SLAB_SIZE;
+            logger.debug("Reserved codecave slab at {}", reinterpret_cast<void *>(slab));
+        }
+
+        auto *cave = arena.slab_top;
+        arena.slab_top += size;
+        return cave;
+    }
+
+    void free_codecave(std::byte *cave, std::size_t size) noexcept {
+        if(!cave) {
+            return;
+        }
+
+        size = aligned_cave_size(size);
+        if(size > CODECAVE_SLAB_SIZE / 4) {
+            VirtualFree(cave, 0, MEM_RELEASE);
+            return;
+        }
+
+        auto &arena = Memory::arena();
+        std::lock_guard<std::mutex> lock(arena.mutex);
+        try {
+            arena.free_caves[size].push_back(cave);
+        }
+        catch(std::bad_alloc &) {
+            // The cave is lost, but it stays valid memory
+        }
+    }
+}
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__MEMORY__CODECAVE_ARENA_HPP
+#define BALLTZE__MEMORY__CODECAVE_ARENA_HPP
+
+#include <cstddef>
+
+namespace Balltze::Memory {
+    /**
+     * Allocate executable memory for a codecave.
+     * Caves are bump-allocated from slabs reserved right after the game executable, which are made
+     * executable once when they are reserved. Freed caves are reused by caves of the same size.
+     * @param size  Size of the cave
+     * @return      Pointer to the cave, or nullptr if no memory could be reserved
+     */
+    std::byte *allocate_codecave(std::size_t size) noexcept;
+
+    /**
+     * Give a cave back to the arena. Nothing may be running in it anymore.
+     * @param cave  Cave returned by allocate_codecave
+     * @param size  Size the cave was allocated with
+     */
+    void free_codecave(std::byte *cave, std::size_t size) noexcept;
+}
+
+#endif
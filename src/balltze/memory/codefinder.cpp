@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-only
 
 #include "codefinder.hpp"
+#include "byte_pattern.hpp"
 #define WIN32_MEAN_AND_LEAN
 #include <windows.h>
 
@@ -26,23 +27,18 @@ PIMAGE_SECTION_HEADER CodeFinder::GetSection(HANDLE module) {
     return NULL;
 }
 
-void CodeFinder::findCode(HANDLE module, const short *signature, size_t size, bool fastFind) {
+void CodeFinder::findCode(HANDLE module, const short *signature, size_t size) {
     PIMAGE_SECTION_HEADER CodeSection = GetSection(module);
 
     if(CodeSection == NULL) {
         return;
     }
 
-    if(fastFind) {
-        boyerFind(signature, size, (BYTE*)module + CodeSection->VirtualAddress, CodeSection->SizeOfRawData);
-    } else {
-        for(size_t i = 0, j = 0; i < CodeSection->SizeOfRawData - size; i++, j = 0) {
-            while(signature[j] == *(reinterpret_cast<BYTE*>(module) + CodeSection->VirtualAddress + i + j) || signature[j] == -1) {
-                if(++j == size) {
-                    locations.emplace_back(CodeSection->VirtualAddress + i + reinterpret_cast<std::uintptr_t>(module));
-                }
-            }
-        }
+    std::byte *memory = reinterpret_cast<std::byte *>(module) + CodeSection->VirtualAddress;
+    std::vector<std::size_t> offsets;
+    Balltze::Memory::BytePattern(signature, size).find(memory, CodeSection->SizeOfRawData, offsets);
+    for(std::size_t offset : offsets) {
+        locations.emplace_back(reinterpret_cast<std::uintptr_t>(memory + offset));
     }
 }
 
@@ -63,13 +59,14 @@ CodeFinder::CodeFinder(HANDLE module, const short* signature, unsigned int signa
 }
 
 std::vector<std::uintptr_t> CodeFinder::find() {
-    bool fastFind = true;
+    if(length == 0) {
+        return locations;
+    }
 
     for(unsigned int i = 0; i < length; i++) {
-        if(signature[i] == -1) {
-            fastFind = false;
-        } else if(signature[i] < 0 || signature[i] > 0xFF) {
+        if(signature[i] != -1 && (signature[i] < 0 || signature[i] > 0xFF)) {
             MessageBox(NULL, "Invalid signature", 0, 0);
+            return locations;
         }
     }
 
@@ -81,35 +78,11 @@ std::vector<std::uintptr_t> CodeFinder::find() {
         return locations;
     }
 
-    findCode(module, signature, length, fastFind);
+    findCode(module, signature, length);
 
     return locations;
 }
 
-void CodeFinder::boyerFind(const short* signature, size_t sigLength, BYTE* memory, size_t memLength) {
-    size_t bad_char_skip[256];
-    size_t last = sigLength - 1;
-
-    for(size_t i = 0; i <= 255; i++) {
-        bad_char_skip[i] = sigLength;
-    }
-
-    for(size_t i = 0; i < last; i++) {
-        bad_char_skip[signature[i]] = last - i;
-    }
-
-    while(memLength >= sigLength) {
-        for(int i = last; signature[i] == memory[i]; i--) {
-            if(i == 0) {
-                locations.emplace_back(reinterpret_cast<std::uintptr_t>(&memory[i]));
-            }
-        }
-
-        memLength -= bad_char_skip[memory[last]];
-        memory += bad_char_skip[memory[last]];
-    }
-}
-
 std::uintptr_t FindCode(HANDLE module, const short* signature, size_t signatureLen, unsigned int match_num) {
 	CodeFinder finder(module, signature, signatureLen);
 	std::vector<std::uintptr_t> locations = finder.find();
@@ -1,54 +1,110 @@
 // SPDX-License-Identifier: GPL-3.0-only
 
 #include <windows.h>
+#include <cstdlib>
+#include <cstring>
 #include <vector>
 #include <memory>
 #include <balltze/memory.hpp>
 #include <balltze/hook.hpp>
-
+#include "../logger.hpp"
+#include "codecave_arena.hpp"
+#include "hook_profiler.hpp"
+#include "hook_trampoline.hpp"
+#include "x86_decoder.hpp"
+
+#ifdef BALLTZE_HOOK_PROFILING
+#define DEFAULT_CAVE_SIZE 256
+#else
 #define DEFAULT_CAVE_SIZE 64
+#endif
 
 namespace Balltze::Memory {
     std::vector<std::unique_ptr<Hook>> hooks;
 
+    struct Codecave::Data {
+        /** Cave itself; allocated from executable memory shared by every cave */
+        std::byte *memory;
+
+        /** Bytes reserved for the cave; the next cave starts right after them */
+        std::size_t capacity;
+
+        /** Cave size */
+        std::size_t top = 0;
+
+        /** Cave is locked? */
+        bool locked = false;
+    };
+
     std::byte &Codecave::top() const {
-        if(m_top == 0) {
+        if(m_data->top == 0) {
             throw std::runtime_error("Codecave is empty");
         }
-        return m_data[m_top - 1];
+        return m_data->memory[m_data->top - 1];
     }
 
     std::byte *Codecave::data() const noexcept {
-        return m_data.get();
+        return m_data->memory;
+    }
+
+    std::size_t Codecave::capacity() const noexcept {
+        return m_data->capacity;
     }
 
     bool Codecave::empty() const noexcept {
-        return m_top == 0;
+        return m_data->top == 0;
     }
 
     void Codecave::lock() noexcept {
-        m_locked = true;
+        m_data->locked = true;
     }
 
     void Codecave::unlock() noexcept {
-        m_locked = false;
+        m_data->locked = false;
+    }
+
+    void Codecave::enable_execute_access(bool) noexcept {
+        // Caves are allocated from executable memory
     }
 
-    void Codecave::enable_execute_access(bool enable) noexcept {
-        if(enable) {
-            VirtualProtect(m_data.get(), m_top, PAGE_EXECUTE_READWRITE, &m_original_page_protection);
+    void Codecave::insert_bytes(const void *bytes, std::size_t size) {
+        if(m_data->locked) {
+            return;
         }
-        else {
-            VirtualProtect(m_data.get(), m_top, m_original_page_protection, NULL);
+        if(size > m_data->capacity - m_data->top) {
+            throw std::runtime_error("Unable to build cave: code does not fit in the cave.");
         }
+        std::memcpy(m_data->memory + m_data->top, bytes, size);
+        m_data->top += size;
     }
 
-    Codecave::Codecave() noexcept {
-        m_data = std::make_unique<std::byte[]>(DEFAULT_CAVE_SIZE);
-    }
+    Codecave::Codecave() noexcept : Codecave(DEFAULT_CAVE_SIZE) {}
 
     Codecave::Codecave(std::size_t size) noexcept {
-        m_data = std::make_unique<std::byte[]>(size);
+        auto *memory = allocate_codecave(size);
+        if(!memory) {
+            logger.fatal("Failed to allocate codecave memory");
+            std::exit(EXIT_FAILURE);
+        }
+        m_data = std::make_unique<Data>(Data{ memory, size });
+    }
+
+    Codecave::Codecave(Codecave &&) noexcept = default;
+
+    Codecave &Codecave::operator=(Codecave &&other) noexcept {
+        if(this != &other) {
+            if(m_data) {
+                free_codecave(m_data->memory, m_data->capacity);
+            }
+            m_data = std::move(other.m_data);
+        }
+        return *this;
+    }
+
+    Codecave::~Codecave() {
+        if(m_data) {
+            free_codecave(m_data->memory, m_data->capacity);
+        }
     }
 
     std::byte *Hook::address() const noexcept {
@@ -68,12 +124,12 @@ namespace Balltze::Memory {
             return;
         }
         m_hooked = true;
-        m_cave.enable_execute_access();
 
         // Overwrite original code with jmp to cave
         fill_with_nops(m_instruction, m_original_code.size());
         overwrite(m_instruction, static_cast<std::byte>(0xE9));
         overwrite(m_instruction + 1, calculate_32bit_jump(m_instruction, m_cave.data()));
+        FlushInstructionCache(GetCurrentProcess(), m_instruction, m_original_code.size());
     }
 
     void Hook::release() noexcept {
@@ -81,409 +137,128 @@ namespace Balltze::Memory {
             return;
         }
         m_hooked = false;
-        m_cave.enable_execute_access(false);
 
         // Restore original code
         overwrite(m_instruction, m_original_code.data(), m_original_code.size());
+        FlushInstructionCache(GetCurrentProcess(), m_instruction, m_original_code.size());
     }
 
-    void Hook::write_function_call(const void *function, bool pushad, bool save_result) noexcept {
-        if(pushad) {
-            m_cave.insert(0x9C); // pushfd
-            m_cave.insert(0x60); // pushad
-        }
+    template<typename Registers>
+    static std::size_t write_trampoline(Codecave &cave, const void *function, bool *result) {
+        cave.insert(Registers::prologue.data(), Registers::prologue.size());
 
-        m_cave.insert(0xE8); // call
-        auto fn_offset = calculate_32bit_jump(&m_cave.top(), function);
-        m_cave.insert_address(fn_offset);
+        cave.insert(0xE8); // call
+        auto fn_offset = calculate_32bit_jump(&cave.top(), function);
+        cave.insert_address(fn_offset);
 
-        if(save_result) {
+        if(result) {
             // mov [m32], al
-            m_cave.insert(0xA2);
-            m_cave.insert_address(m_skip_original_code.get());
+            cave.insert(0xA2);
+            cave.insert_address(result);
         }
 
-        if(pushad) {
-            m_cave.insert(0x61); // popad
-            m_cave.insert(0x9D); // popfd
+        cave.insert(Registers::epilogue.data(), Registers::epilogue.size());
+        return trampoline_size<Registers>(result != nullptr);
+    }
+
+    std::size_t Hook::write_function_call(const void *function, HookRegisters saved_registers, bool save_result) {
+        auto *result = save_result ? m_skip_original_code.get() : nullptr;
+        std::size_t size = 0;
+
+#ifdef BALLTZE_HOOK_PROFILING
+        auto *profile = create_hook_profile(m_instruction, function);
+        size += write_hook_profile_start(m_cave, profile);
+#endif
+
+        switch(saved_registers) {
+            case HOOK_REGISTERS_NONE:
+                size += write_trampoline<TrampolineSaveNothing>(m_cave, function, result);
+                break;
+            case HOOK_REGISTERS_CDECL:
+                size += write_trampoline<TrampolineSaveCdecl>(m_cave, function, result);
+                break;
+            default:
+                size += write_trampoline<TrampolineSaveAll>(m_cave, function, result);
+                break;
         }
+
+#ifdef BALLTZE_HOOK_PROFILING
+        size += write_hook_profile_end(m_cave, profile);
+#endif
+
+        return size;
     }
 
     void Hook::copy_instructions(const void *address, std::uint8_t &copied_bytes) {
         auto *instruction = reinterpret_cast<const std::uint8_t *>(address);
+        std::size_t original_size = 0;
         copied_bytes = 0;
-        std::size_t instruction_size = 0;
-
-        while(copied_bytes < 5) {
-            instruction += instruction_size;
-
-            switch(instruction[0]) {
-                // call rel32
-                case 0xE8: 
-                // jmp rel32
-                case 0xE9: {
-                    m_cave.insert(instruction[0]); // call or jmp
-
-                    // offset
-                    auto original_offset = *reinterpret_cast<const std::uint32_t *>(&instruction[1]);
-                    auto offset = original_offset + calculate_32bit_jump(&m_cave.top(), &instruction[5]);
-                    m_cave.insert_address(offset);
-                    
-                    instruction_size = 5;
-                    break;
-                }
-
-                // mov r/m8, imm8
-                case 0xC6: {
-                    m_cave.insert(0xC6);
-
-                    // mov [esp + disp8], imm8
-                    if(instruction[1] == 0x44 && instruction[2] == 0x24) {
-                        m_cave.insert(&instruction[1], 4);
-                        instruction_size = 5;
-                    }
-                    else {
-                        throw std::runtime_error("Unsupported mov instruction.");
-                    }
-                    break;
-                }
-
-                // mov r8, byte ptr [r32 + disp8]
-                case 0x8A: {
-                    switch(instruction[1]) {
-                        case 0x47: { // al, edi
-                            m_cave.insert(&instruction[0], 3);
-                            instruction_size = 3;
-                            break;
-                        }
-
-                        case 0x07: {
-                            m_cave.insert(&instruction[0], 2);
-                            instruction_size = 2;
-                            break;
-                        }
-
-                        default: {
-                            throw std::runtime_error("Unsupported mov instruction.");
-                        }
-                    }
-                    break;
-                }
-
-                // test r/m8,r8
-                case 0x84: {
-                    m_cave.insert(&instruction[0], 2);
-                    instruction_size = 2;
-                    break;
-                }
-
-                // far call / jump
-                case 0xFF: {
-                    m_cave.insert(0xFF);
-
-                    // call dword ptr [edx + disp32]
-                    if(instruction[1] == 0x92 || instruction[1] == 0x91) {
-                        m_cave.insert(&instruction[1], 5);
-
-                        instruction_size = 6;
-                        break;
-                    }
-                    // call dword ptr [edx + disp8]
-                    else if(instruction[1] == 0x52 || instruction[1] == 0x51) {
-                        m_cave.insert(&instruction[1], 3);
-
-                        instruction_size = 3;
-                        break;
-                    }
-                    // jmp dword ptr [eax ^ 4 + m32]
-                    else if(instruction[1] == 0x24 && instruction[2] == 0x85) {
-                        m_cave.insert(0x24);
-                        m_cave.insert(0x85);
-                        m_cave.insert(&instruction[3], 4);
-
-                        instruction_size = 7;
-                        break;
-                    }
-                    // call dword ptr [imm32]
-                    else if(instruction[1] == 0x15) {
-                        m_cave.insert(0x15);
-                        m_cave.insert(&instruction[2], 4);
-                        instruction_size = 6;
-                        break;
-                    }
-                    else {
-                        throw std::runtime_error("Unsupported call instruction.");
-                    }
-                }
-
-                // test
-                case 0x85: {
-                    // test eax, eax (?)
-                    if(instruction[1] == 0xC0) {
-                        m_cave.insert(0xC0);
-                        instruction_size = 2;
-                    }
-                    else {
-                        throw std::runtime_error("Unsupported test instruction.");
-                    }
-                    break;
-                }
-
-                // movsx / sete
-                case 0x0F: {
-                    if(instruction[1] == 0xB6 && instruction[2] == 0x47) { // eax, byte ptr [edi + disp8]
-                        m_cave.insert(&instruction[0], 4);
-                        instruction_size = 4;
-                    }
-                    else if(instruction[1] == 0xBF && (instruction[2] == 0xC0 || instruction[2] == 0xC1 || instruction[2] == 0xC5)) { // eax, ax/cx/bp
-                        m_cave.insert(&instruction[0], 3);
-                        instruction_size = 3;
-                    }
-                    else if(instruction[1] == 0x94 && instruction[2] == 0xC1) { // sete cl
-                        m_cave.insert(&instruction[0], 3);
-                        instruction_size = 3;
-                    }
-                    else if(instruction[1] == 0x87) {
-                        m_cave.insert(instruction[0]); 
-                        m_cave.insert(instruction[1]); 
-                        auto original_offset = *reinterpret_cast<const std::uint32_t *>(&instruction[2]);
-                        auto offset = original_offset + calculate_32bit_jump(&m_cave.top(), &instruction[6]);
-                        m_cave.insert_address(offset);
-                        instruction_size = 6;
-                    }
-                    else {
-                        throw std::runtime_error("Unsupported movzx instruction.");
-                    }
-                    break;
-                }
-
-                // cmp / inc
-                case 0x66: {
-                    if(instruction[1] == 0x39 && instruction[2] == 0x46) { // cmp word ptr [esi + disp8], ax
-                        m_cave.insert(&instruction[0], 4);
-                        instruction_size = 4;
-                    }
-                    else if(instruction[1] == 0xFF && instruction[2] == 0x05) { // inc word ptr [imm32]
-                        m_cave.insert(&instruction[0], 7);
-                        instruction_size = 7;
-                    }
-                    else if(instruction[1] == 0xC7 && instruction[2] == 0x00) { // cmp word ptr [r32], imm16
-                        m_cave.insert(&instruction[0], 5);
-                        instruction_size = 5;
-                    }
-                    else if(instruction[1] == 0x8B && instruction[2] == 0x0D) {
-                        m_cave.insert(&instruction[0], 7);
-                        instruction_size = 7;
-                    }
-                    else if(instruction[1] == 0x89 && instruction[2] == 0x78) { // mov word ptr [eax + disp8], di
-                        m_cave.insert(&instruction[0], 4);
-                        instruction_size = 4;
-                    }
-                    else {
-                        throw std::runtime_error("Unsupported cmp instruction.");
-                    }
-                    break;
-                }
-
-                // cmp al, imm8
-                case 0x3C: {
-                    m_cave.insert(&instruction[0], 2);
-                    instruction_size = 2;
-                    break;
-                }
-
-                // dec eax
-                case 0x48: {
-                    m_cave.insert(&instruction[0], 1);
-                    instruction_size = 1;
-                    break;
-                }
 
-                // cmp / add / sub
-                case 0x83: {
-                    if(instruction[1] == 0xF8) { // eax, imm8
-                        m_cave.insert(&instruction[0], 3);
-                        instruction_size = 3;
-                    }
-                    else if(instruction[1] == 0xC4) {
-                        m_cave.insert(&instruction[0], 3);
-                        instruction_size = 3;
-                    }
-                    else if(instruction[1] == 0xEC) { // sub esp, imm8
-                        m_cave.insert(&instruction[0], 3);
-                        instruction_size = 3;
-                    }
-                    else {
-                        throw std::runtime_error("Unsupported cmp/add/sub instruction.");
-                    }
-                    break;
-                }
-
-                // nop
-                case 0x90: {
-                    m_cave.insert(0x90);
-                    instruction_size = 1;
-                    break;
-                }
-
-                // lea / mov
-                case 0x8D:
-                case 0x8B: {
-                    if(instruction[1] == 0x4C && instruction[2] == 0x24) {
-                        m_cave.insert(&instruction[0], 4);
-                        instruction_size = 4;
-                    }
-                    else if(instruction[1] == 0x84 && instruction[2] == 0x24) {
-                        m_cave.insert(&instruction[0], 7);
-                        instruction_size = 7;
-                    }
-                    else if(instruction[1] == 0xD8) {
-                        m_cave.insert(&instruction[0], 2);
-                        instruction_size = 2;
-                    }
-                    else if(instruction[1] == 0x56) { // mov edx, [esi + imm8]
-                        m_cave.insert(&instruction[0], 3);
-                        instruction_size = 3;
-                    }
-                    else if(instruction[1] == 0xC9) {
-                        m_cave.insert(&instruction[0], 2);
-                        instruction_size = 2;
-                    }
-                    else if(instruction[1] == 0x0D) {
-                        m_cave.insert(&instruction[0], 6);
-                        instruction_size = 6;
-                    }
-                    else if(instruction[1] == 0x34 && instruction[2] == 0x40) {
-                        m_cave.insert(&instruction[0], 3);
-                        instruction_size = 3;
-                    }
-                    else if(instruction[1] == 0x04 && instruction[2] == 0x40) {
-                        m_cave.insert(&instruction[0], 3);
-                        instruction_size = 3;
-                    }
-                    else if(instruction[1] == 0xF1) {
-                        m_cave.insert(&instruction[0], 2);
-                        instruction_size = 2;
-                    }
-                    // mov ebx, dword ptr [esp + disp8]
-                    else if(instruction[1] == 0x5C && instruction[2] == 0x24) {
-                        m_cave.insert(&instruction[0], 4);
-                        instruction_size = 4;
-                    }
-                    // mov eax, dword ptr [eax + disp8]
-                    else if(instruction[1] == 0x40) {
-                        m_cave.insert(&instruction[0], 3);
-                        instruction_size = 3;
-                    }
-                    // mov ecx, dword ptr [eax + disp8]
-                    else if(instruction[1] == 0x48) {
-                        m_cave.insert(&instruction[0], 3);
-                        instruction_size = 3;
-                    }
-                    // mov edx, dword ptr [esp + disp8]
-                    else if(instruction[1] == 0x54 && instruction[2] == 0x24) {
-                        m_cave.insert(&instruction[0], 4);
-                        instruction_size = 4;
-                    }
-                    else {
-                        throw std::runtime_error("Unsupported lea / mov instruction.");
-                    }
-                    break;
-                }
-
-                // mov
-                case 0x89: {
-                    if(instruction[1] == 0x72) { // mov [edx + imm8], esi
-                        m_cave.insert(&instruction[0], 3);
-                        instruction_size = 3;
-                    }
-                    else if(instruction[1] == 0x3D) {
-                        m_cave.insert(&instruction[0], 6);
-                        instruction_size = 6;
-                    }
-                    else {
-                        throw std::runtime_error("Unsupported mov instruction.");
-                    }
-                    break;
-                }
-
-                // push r32 / pop r32 
-                case 0x50 ... 0x5F: {
-                    m_cave.insert(instruction[0]);
-                    instruction_size = 1;
-                    break;
-                }
+        while(original_size < 5) {
+            X86Instruction decoded;
+            if(!decode_x86_instruction(instruction, X86_MAX_INSTRUCTION_LENGTH, decoded)) {
+                char message[256];
+                snprintf(message, sizeof(message), "Unable to build cave: unsupported instruction. \nOpcode: 0x%.2X at 0x%p", instruction[decoded.prefix_count], instruction);
+                throw std::runtime_error(message);
+            }
 
-                // sub / cmp
-                case 0x81: {
-                    if(instruction[1] == 0xEC) { // sub esp, imm32
-                        m_cave.insert(&instruction[0], 6);
-                        instruction_size = 6;
-                    }
-                    else if(instruction[1] == 0xFD || instruction[1] == 0xFE) { // cmp ebp/esi, imm32
-                        m_cave.insert(&instruction[0], 6);
-                        instruction_size = 6;
-                    }
-                    else {
-                        throw std::runtime_error("Unsupported sub instruction.");
-                    }
-                    break;
+            auto *next_instruction = instruction + decoded.length;
+            if(decoded.relative_size == 0) {
+                m_cave.insert(instruction, decoded.length);
+                copied_bytes += decoded.length;
+            }
+            else {
+                std::int32_t displacement;
+                if(decoded.relative_size == 1) {
+                    displacement = *reinterpret_cast<const std::int8_t *>(&instruction[decoded.relative_offset]);
                 }
-
-                // mov
-                case 0xA0 ... 0xA1: {
-                    m_cave.insert(&instruction[0], 5);
-                    instruction_size = 5;
-                    break;
+                else if(decoded.relative_size == 4) {
+                    displacement = *reinterpret_cast<const std::int32_t *>(&instruction[decoded.relative_offset]);
                 }
-
-                // xor bl, bl
-                case 0x32: {
-                    m_cave.insert(&instruction[0], 2);
-                    instruction_size = 2;
-                    break;
+                else {
+                    throw std::runtime_error("Unable to build cave: unsupported 16-bit relative branch.");
                 }
+                auto *target = next_instruction + displacement;
 
-                // and eax, imm32
-                case 0x25: {
-                    m_cave.insert(&instruction[0], 5);
-                    instruction_size = 5;
-                    break;
-                }
+                // Prefixes are kept as they are
+                m_cave.insert(instruction, decoded.prefix_count);
+                std::size_t cave_size = decoded.prefix_count;
 
-                // inc eax
-                case 0x40: {
-                    m_cave.insert(0x40);
-                    instruction_size = 1;
-                    break;
+                if(decoded.relative_size == 4) {
+                    // call/jmp/jcc rel32
+                    auto opcode_size = decoded.relative_offset - decoded.prefix_count;
+                    m_cave.insert(instruction + decoded.prefix_count, opcode_size);
+                    cave_size += opcode_size;
                 }
-
-                // xor ebp, ebp
-                case 0x33: {
-                    m_cave.insert(&instruction[0], 2);
-                    instruction_size = 2;
-                    break;
+                else if(decoded.opcode >= 0x70 && decoded.opcode <= 0x7F) {
+                    // jcc rel8 -> jcc rel32
+                    m_cave.insert(0x0F);
+                    m_cave.insert(0x80 | (decoded.opcode & 0x0F));
+                    cave_size += 2;
                 }
-
-                // push m32
-                case 0x68: {
-                    m_cave.insert(&instruction[0], 5);
-                    instruction_size = 5;
-                    break;
+                else if(decoded.opcode == 0xEB) {
+                    // jmp rel8 -> jmp rel32
+                    m_cave.insert(0xE9);
+                    cave_size += 1;
                 }
-
-                default: {
+                else {
+                    // loop/jecxz only have an 8-bit form
                     char message[256];
-                    snprintf(message, sizeof(message), "Unable to build cave: unsupported instruction. \nOpcode: 0x%.2X at 0x%p", instruction[0], instruction);
+                    snprintf(message, sizeof(message), "Unable to build cave: 0x%.2X can't be relocated. \nAt 0x%p", decoded.opcode, instruction);
                     throw std::runtime_error(message);
                 }
+
+                auto offset = calculate_32bit_jump(&m_cave.top(), target);
+                m_cave.insert_address(offset);
+                copied_bytes += cave_size + 4;
             }
 
             // Backup original instruction
             auto *instruction_bytes = reinterpret_cast<const std::byte *>(instruction);
-            m_original_code.insert(m_original_code.end(), instruction_bytes, instruction_bytes + instruction_size);
+            m_original_code.insert(m_original_code.end(), instruction_bytes, instruction_bytes + decoded.length);
 
-            copied_bytes += instruction_size;
+            original_size += decoded.length;
+            instruction = next_instruction;
         }
     }
 
@@ -497,20 +272,26 @@ namespace Balltze::Memory {
         }
     }
 
-    void Hook::write_cave_return_jmp() noexcept {
+    void Hook::write_cave_return_jmp() {
         m_cave.insert(0xE9);
         auto offset = calculate_32bit_jump(&m_cave.top(), m_instruction + m_original_code.size());
         m_cave.insert_address(offset);
     }
 
     Hook *hook_function(void *instruction, std::optional<std::variant<std::function<void()>, std::function<bool()>>> function_before, std::optional<std::function<void()>> function_after, bool save_registers, bool do_not_hook) {
+        return hook_function(instruction, function_before, function_after, save_registers ? HOOK_REGISTERS_ALL : HOOK_REGISTERS_NONE, do_not_hook);
+    }
+
+    Hook *hook_function(void *instruction, std::optional<std::variant<std::function<void()>, std::function<bool()>>> function_before, std::optional<std::function<void()>> function_after, HookRegisters saved_registers, bool do_not_hook) {
         for(auto &hook : hooks) {
             if(hook->m_instruction == instruction) {
                 throw std::runtime_error("address already hooked");
             }
         }
 
-        Hook *hook = hooks.emplace_back(std::make_unique<Hook>()).get();
+        // Only kept once it is built; a hook that fails to build gives its cave back to the arena
+        auto new_hook = std::make_unique<Hook>();
+        Hook *hook = new_hook.get();
         hook->m_instruction = reinterpret_cast<std::byte *>(instruction);
         hook->m_skip_original_code = std::make_unique<bool>(false);
 
@@ -522,14 +303,14 @@ namespace Balltze::Memory {
                 if(!function) {
                     throw std::invalid_argument("function_before must be a valid function");
                 }
-                hook->write_function_call(*reinterpret_cast<void **>(function.target<bool(*)()>()), save_registers, true);
+                hook->write_function_call(*reinterpret_cast<void **>(function.target<bool(*)()>()), saved_registers, true);
             }
             else {
                 auto function = std::get<std::function<void()>>(function_variant);
                 if(!function) {
                     throw std::invalid_argument("function_before must be a valid function");
                 }
-                hook->write_function_call(*reinterpret_cast<void **>(function.target<void(*)()>()), save_registers, false);
+                hook->write_function_call(*reinterpret_cast<void **>(function.target<void(*)()>()), saved_registers, false);
             }
         
             // cmp byte ptr [flag], 1
@@ -552,15 +333,19 @@ namespace Balltze::Memory {
                 throw;
             }
 
-            jmp_offset = instruction_size;
+            std::size_t skipped_size = instruction_size;
 
             if(function_after) {
                 if(!*function_after) {
                     throw std::invalid_argument("function_after must be a valid function");
                 }
-                hook->write_function_call(*reinterpret_cast<void **>(function_after.value().target<void(*)()>()), save_registers);
-                jmp_offset += save_registers ? 9 : 5;
+                skipped_size += hook->write_function_call(*reinterpret_cast<void **>(function_after.value().target<void(*)()>()), saved_registers);
+            }
+
+            if(skipped_size > INT8_MAX) {
+                throw std::runtime_error("Unable to build cave: skipped code is too big for a short jump.");
             }
+            jmp_offset = skipped_size;
         }
         else {
             std::uint8_t instruction_size;
@@ -575,11 +360,12 @@ namespace Balltze::Memory {
                 if(!*function_after) {
                     throw std::invalid_argument("function_after must be a valid function");
                 }
-                hook->write_function_call(*reinterpret_cast<void **>(function_after.value().target<void(*)()>()), save_registers);
+                hook->write_function_call(*reinterpret_cast<void **>(function_after.value().target<void(*)()>()), saved_registers);
             }
         }
 
         hook->write_cave_return_jmp();
+        hooks.push_back(std::move(new_hook));
         if(!do_not_hook) {
             hook->hook();
         }
@@ -597,7 +383,8 @@ namespace Balltze::Memory {
             throw std::invalid_argument("function must be a valid function");
         }
 
-        Hook *hook = hooks.emplace_back(std::make_unique<Hook>()).get();
+        auto new_hook = std::make_unique<Hook>();
+        Hook *hook = new_hook.get();
         hook->m_instruction = reinterpret_cast<std::byte *>(instruction);
 
         hook->m_cave.insert(0xE9);
@@ -616,6 +403,7 @@ namespace Balltze::Memory {
             hook->write_cave_return_jmp();
         }
         
+        hooks.push_back(std::move(new_hook));
         if(!do_not_hook) {
             hook->hook();
         }
@@ -629,11 +417,23 @@ namespace Balltze::Memory {
             }
         }
 
-        Hook *hook = hooks.emplace_back(std::make_unique<Hook>()).get();
+        auto new_hook = std::make_unique<Hook>();
+        Hook *hook = new_hook.get();
         hook->m_instruction = reinterpret_cast<std::byte *>(instruction);
 
+        auto *function_address = *reinterpret_cast<void **>(function.target<void(*)()>());
+
+#ifdef BALLTZE_HOOK_PROFILING
+        auto *profile = create_hook_profile(instruction, function_address);
+        write_hook_profile_start(hook->m_cave, profile);
+#endif
+
         hook->m_cave.insert(0xE8);
-        hook->m_cave.insert_address(calculate_32bit_jump(&hook->m_cave.top(), *reinterpret_cast<void **>(function.target<void(*)()>())));
+        hook->m_cave.insert_address(calculate_32bit_jump(&hook->m_cave.top(), function_address));
+
+#ifdef BALLTZE_HOOK_PROFILING
+        write_hook_profile_end(hook->m_cave, profile);
+#endif
 
         hook->m_cave.lock();
         std::uint8_t instruction_size;
@@ -646,6 +446,7 @@ namespace Balltze::Memory {
         hook->m_cave.unlock();
 
         hook->write_cave_return_jmp();
+        hooks.push_back(std::move(new_hook));
         if(!do_not_hook) {
             hook->hook();
         }
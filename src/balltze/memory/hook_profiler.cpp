@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifdef BALLTZE_HOOK_PROFILING
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <impl/terminal/terminal.h>
+#include "../command/command.hpp"
+#include "../config/config.hpp"
+#include "../logger.hpp"
+#include "hook_profiler.hpp"
+
+#define DEFAULT_PRINTED_HOOK_PROFILES 10
+
+namespace Balltze::Memory {
+    static std::deque<HookProfile> profiles;
+
+    HookProfile *create_hook_profile(const void *instruction, const void *function) {
+        return &profiles.emplace_back(HookProfile{ instruction, function, 0, 0, 0 });
+    }
+
+    static std::uint32_t low_dword(const std::uint64_t *value) noexcept {
+        return reinterpret_cast<std::uint32_t>(value);
+    }
+
+    static std::uint32_t high_dword(const std::uint64_t *value) noexcept {
+        return reinterpret_cast<std::uint32_t>(value) + 4;
+    }
+
+    std::size_t write_hook_profile_start(Codecave &cave, HookProfile *profile) {
+        cave.insert(0x50); // push eax
+        cave.insert(0x52); // push edx
+
+        // rdtsc
+        cave.insert(0x0F);
+        cave.insert(0x31);
+
+        // mov [start], eax
+        cave.insert(0xA3);
+        cave.insert_address(low_dword(&profile->start));
+
+        // mov [start + 4], edx
+        cave.insert(0x89);
+        cave.insert(0x15);
+        cave.insert_address(high_dword(&profile->start));
+
+        cave.insert(0x5A); // pop edx
+        cave.insert(0x58); // pop eax
+        return 17;
+    }
+
+    std::size_t write_hook_profile_end(Codecave &cave, HookProfile *profile) {
+        cave.insert(0x9C); // pushfd
+        cave.insert(0x50); // push eax
+        cave.insert(0x52); // push edx
+
+        // rdtsc
+        cave.insert(0x0F);
+        cave.insert(0x31);
+
+        // sub eax, [start]
+        cave.insert(0x2B);
+        cave.insert(0x05);
+        cave.insert_address(low_dword(&profile->start));
+
+        // sbb edx, [start + 4]
+        cave.insert(0x1B);
+        cave.insert(0x15);
+        cave.insert_address(high_dword(&profile->start));
+
+        // add [cycles], eax
+        cave.insert(0x01);
+        cave.insert(0x05);
+        cave.insert_address(low_dword(&profile->cycles));
+
+        // adc [cycles + 4], edx
+        cave.insert(0x11);
+        cave.insert(0x15);
+        cave.insert_address(high_dword(&profile->cycles));
+
+        // add dword ptr [calls], 1
+        cave.insert(0x83);
+        cave.insert(0x05);
+        cave.insert_address(low_dword(&profile->calls));
+        cave.insert(0x01);
+
+        // adc dword ptr [calls + 4], 0
+        cave.insert(0x83);
+        cave.insert(0x15);
+        cave.insert_address(high_dword(&profile->calls));
+        cave.insert(0x00);
+
+        cave.insert(0x5A); // pop edx
+        cave.insert(0x58); // pop eax
+        cave.insert(0x9D); // popfd
+        return 46;
+    }
+
+    static std::uint64_t cycles_per_call(const HookProfile &profile) noexcept {
+        return profile.calls > 0 ? profile.cycles / profile.calls : 0;
+    }
+
+    static void print_profiles(const char *title, const std::vector<const HookProfile *> &sorted_profiles, std::size_t count) {
+        terminal_info_printf("%s", title);
+        for(std::size_t i = 0; i < sorted_profiles.size() && i < count; i++) {
+            auto &profile = *sorted_profiles[i];
+            terminal_info_printf("%2zu. 0x%p -> 0x%p: %llu calls, %llu cycles, %llu cycles/call", i + 1, profile.instruction, profile.function, profile.calls, profile.cycles, cycles_per_call(profile));
+        }
+    }
+
+    void set_up_hook_profiler() {
+        CommandBuilder()
+            .name("hook_profile")
+            .category("debug")
+            .help("Prints the hooks with the most cycles spent in total and per call.")
+            .param(HSC_DATA_TYPE_SHORT, "count", true)
+            .function([](const std::vector<std::string> &args) -> bool {
+                std::size_t count = DEFAULT_PRINTED_HOOK_PROFILES;
+                if(args.size() == 1) {
+                    auto requested_count = std::stoi(args[0]);
+                    if(requested_count <= 0) {
+                        terminal_error_printf("Count must be greater than zero");
+                        return false;
+                    }
+                    count = requested_count;
+                }
+
+                std::vector<const HookProfile *> sorted_profiles;
+                for(auto &profile : profiles) {
+                    if(profile.calls > 0) {
+                        sorted_profiles.push_back(&profile);
+                    }
+                }
+                if(sorted_profiles.empty()) {
+                    terminal_info_printf("No hook has been called yet");
+                    return true;
+                }
+
+                std::sort(sorted_profiles.begin(), sorted_profiles.end(), [](auto *a, auto *b) {
+                    return a->cycles > b->cycles;
+                });
+                print_profiles("Hooks by total cycles:", sorted_profiles, count);
+
+                std::sort(sorted_profiles.begin(), sorted_profiles.end(), [](auto *a, auto *b) {
+                    return cycles_per_call(*a) > cycles_per_call(*b);
+                });
+                print_profiles("Hooks by cycles per call:", sorted_profiles, count);
+                return true;
+            })
+            .can_call_from_console()
+            .is_core()
+            .create(COMMAND_SOURCE_BALLTZE);
+
+        CommandBuilder()
+            .name("hook_profile_dump")
+            .category("debug")
+            .help("Writes the calls and cycles of every hook to hook_profile.csv in the Balltze directory.")
+            .function([](const std::vector<std::string> &args) -> bool {
+                auto path = Config::get_balltze_directory() / "hook_profile.csv";
+                std::ofstream file(path);
+                if(!file.is_open()) {
+                    terminal_error_printf("Failed to open %s", path.string().c_str());
+                    return false;
+                }
+
+                file << "instruction,function,calls,cycles,cycles_per_call\n";
+                for(auto &profile : profiles) {
+                    char line[128];
+                    snprintf(line, sizeof(line), "0x%p,0x%p,%llu,%llu,%llu\n", profile.instruction, profile.function, profile.calls, profile.cycles, cycles_per_call(profile));
+                    file << line;
+                }
+                terminal_info_printf("Wrote %zu hook profiles to %s", profiles.size(), path.string().c_str());
+                return true;
+            })
+            .can_call_from_console()
+            .is_core()
+            .create(COMMAND_SOURCE_BALLTZE);
+
+        logger.debug("Hook profiling is enabled");
+    }
+}
+
+#endif
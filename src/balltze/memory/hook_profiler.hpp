@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__MEMORY__HOOK_PROFILER_HPP
+#define BALLTZE__MEMORY__HOOK_PROFILER_HPP
+
+#ifdef BALLTZE_HOOK_PROFILING
+
+#include <cstdint>
+#include <cstddef>
+#include <balltze/hook.hpp>
+
+namespace Balltze::Memory {
+    /**
+     * Calls and cycles of a function called from a hook cave.
+     */
+    struct HookProfile {
+        /** Address of the hooked instruction */
+        const void *instruction;
+
+        /** Function called from the cave */
+        const void *function;
+
+        /** Number of calls */
+        std::uint64_t calls;
+
+        /** Cycles spent in the calls, register saving included */
+        std::uint64_t cycles;
+
+        /** Timestamp counter when the current call started; nested calls of the same hook are not supported */
+        std::uint64_t start;
+    };
+
+    /**
+     * Create the profile of a function called from a hook.
+     * Profiles are never freed, so caves can point to them.
+     * @param instruction   Address of the hooked instruction
+     * @param function      Function called from the cave
+     */
+    HookProfile *create_hook_profile(const void *instruction, const void *function);
+
+    /**
+     * Write the code that reads the timestamp counter before a function call.
+     * Every register and the flags are preserved.
+     * @return  Number of bytes written
+     */
+    std::size_t write_hook_profile_start(Codecave &cave, HookProfile *profile);
+
+    /**
+     * Write the code that adds the call and the cycles since the start to the profile.
+     * Every register and the flags are preserved.
+     * @return  Number of bytes written
+     */
+    std::size_t write_hook_profile_end(Codecave &cave, HookProfile *profile);
+
+    /**
+     * Set up the hook profiler commands.
+     */
+    void set_up_hook_profiler();
+}
+
+#endif
+
+#endif
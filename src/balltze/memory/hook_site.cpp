@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <balltze/memory.hpp>
+#include <balltze/hook.hpp>
+#include "hook_profiler.hpp"
+#include "hook_trampoline.hpp"
+
+#ifdef BALLTZE_HOOK_PROFILING
+#define HOOK_SITE_CAVE_SIZE 256
+#else
+#define HOOK_SITE_CAVE_SIZE 128
+#endif
+
+namespace Balltze::Memory {
+    extern std::vector<std::unique_ptr<Hook>> hooks;
+    static std::vector<std::unique_ptr<HookSite>> hook_sites;
+
+    /**
+     * Write a call to a site dispatcher into a cave, saving what a __cdecl function may clobber.
+     */
+    static void write_dispatcher_call(Codecave &cave, HookSite *site, void (*dispatcher)(HookSite *)) {
+#ifdef BALLTZE_HOOK_PROFILING
+        auto *profile = create_hook_profile(site->hook()->address(), reinterpret_cast<void *>(dispatcher));
+        write_hook_profile_start(cave, profile);
+#endif
+
+        cave.insert(TrampolineSaveCdecl::prologue.data(), TrampolineSaveCdecl::prologue.size());
+
+        // push site
+        cave.insert(0x68);
+        cave.insert_address(site);
+
+        // call dispatcher
+        cave.insert(0xE8);
+        cave.insert_address(calculate_32bit_jump(&cave.top(), reinterpret_cast<void *>(dispatcher)));
+
+        // add esp, 4
+        cave.insert(0x83);
+        cave.insert(0xC4);
+        cave.insert(0x04);
+
+        cave.insert(TrampolineSaveCdecl::epilogue.data(), TrampolineSaveCdecl::epilogue.size());
+
+#ifdef BALLTZE_HOOK_PROFILING
+        write_hook_profile_end(cave, profile);
+#endif
+    }
+
+    HookSite::HookSite(void *instruction) {
+        m_hook = hooks.emplace_back(std::make_unique<Hook>(HOOK_SITE_CAVE_SIZE)).get();
+        m_hook->m_instruction = reinterpret_cast<std::byte *>(instruction);
+
+        try {
+            write_dispatcher_call(m_hook->m_cave, this, dispatch_before);
+            m_hook->copy_instructions(instruction);
+            write_dispatcher_call(m_hook->m_cave, this, dispatch_after);
+            m_hook->write_cave_return_jmp();
+        }
+        catch(...) {
+            // Destroying the hook gives its cave back to the arena
+            hooks.pop_back();
+            throw;
+        }
+    }
+
+    void HookSite::insert_handler(const Handler &handler) {
+        auto &handlers = handler.after ? m_after_handlers : m_before_handlers;
+        auto position = std::upper_bound(handlers.begin(), handlers.end(), handler.priority, [](int priority, const Handler &other) {
+            return priority > other.priority;
+        });
+        handlers.insert(position, handler);
+    }
+
+    void HookSite::dispatch_before(HookSite *site) noexcept {
+        site->dispatch(site->m_before_handlers);
+    }
+
+    void HookSite::dispatch_after(HookSite *site) noexcept {
+        site->dispatch(site->m_after_handlers);
+    }
+
+    void HookSite::dispatch(std::vector<Handler> &handlers) noexcept {
+        m_dispatch_depth++;
+        for(std::size_t i = 0; i < handlers.size(); i++) {
+            auto function = handlers[i].function;
+            if(function) {
+                function();
+            }
+        }
+        m_dispatch_depth--;
+
+        if(m_dispatch_depth > 0) {
+            return;
+        }
+
+        // Apply the changes made by the handlers
+        if(m_removed_handlers) {
+            auto removed = [](const Handler &handler) {
+                return handler.function == nullptr;
+            };
+            m_before_handlers.erase(std::remove_if(m_before_handlers.begin(), m_before_handlers.end(), removed), m_before_handlers.end());
+            m_after_handlers.erase(std::remove_if(m_after_handlers.begin(), m_after_handlers.end(), removed), m_after_handlers.end());
+            m_removed_handlers = false;
+        }
+        if(!m_pending_handlers.empty()) {
+            for(auto &handler : m_pending_handlers) {
+                insert_handler(handler);
+            }
+            m_pending_handlers.clear();
+        }
+    }
+
+    std::size_t HookSite::add_handler(HookHandler handler, bool after, int priority) {
+        if(!handler) {
+            throw std::invalid_argument("handler must be a valid function");
+        }
+
+        Handler new_handler = { handler, priority, m_next_handle++, after };
+        if(m_dispatch_depth > 0) {
+            m_pending_handlers.push_back(new_handler);
+        }
+        else {
+            insert_handler(new_handler);
+        }
+        return new_handler.handle;
+    }
+
+    bool HookSite::remove_handler(std::size_t handle) noexcept {
+        auto pending = std::find_if(m_pending_handlers.begin(), m_pending_handlers.end(), [handle](const Handler &handler) {
+            return handler.handle == handle;
+        });
+        if(pending != m_pending_handlers.end()) {
+            m_pending_handlers.erase(pending);
+            return true;
+        }
+
+        for(auto *handlers : { &m_before_handlers, &m_after_handlers }) {
+            auto it = std::find_if(handlers->begin(), handlers->end(), [handle](const Handler &handler) {
+                return handler.handle == handle && handler.function;
+            });
+            if(it == handlers->end()) {
+                continue;
+            }
+
+            // Handlers can't be moved while the array is being walked
+            if(m_dispatch_depth > 0) {
+                it->function = nullptr;
+                m_removed_handlers = true;
+            }
+            else {
+                handlers->erase(it);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    std::size_t HookSite::handler_count() const noexcept {
+        auto count_handlers = [](const std::vector<Handler> &handlers) {
+            return static_cast<std::size_t>(std::count_if(handlers.begin(), handlers.end(), [](const Handler &handler) {
+                return handler.function != nullptr;
+            }));
+        };
+        return count_handlers(m_before_handlers) + count_handlers(m_after_handlers) + m_pending_handlers.size();
+    }
+
+    Hook *HookSite::hook() const noexcept {
+        return m_hook;
+    }
+
+    HookSite *get_hook_site(void *instruction, bool do_not_hook) {
+        for(auto &site : hook_sites) {
+            if(site->m_hook->address() == instruction) {
+                return site.get();
+            }
+        }
+
+        for(auto &hook : hooks) {
+            if(hook->address() == instruction) {
+                char message[256];
+                snprintf(message, sizeof(message), "address 0x%p is already hooked by a regular hook", instruction);
+                throw std::runtime_error(message);
+            }
+        }
+
+        auto *site = hook_sites.emplace_back(std::make_unique<HookSite>(instruction)).get();
+        if(!do_not_hook) {
+            site->m_hook->hook();
+        }
+        return site;
+    }
+}
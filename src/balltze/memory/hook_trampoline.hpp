@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__MEMORY__HOOK_TRAMPOLINE_HPP
+#define BALLTZE__MEMORY__HOOK_TRAMPOLINE_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+namespace Balltze::Memory {
+    /**
+     * Code a hook wraps around a function call to preserve the state of the hooked code.
+     * The call itself is a 5 byte call rel32, optionally followed by a 5 byte mov [m32], al to store the result.
+     */
+    struct TrampolineSaveNothing {
+        static constexpr std::array<std::uint8_t, 0> prologue = {};
+        static constexpr std::array<std::uint8_t, 0> epilogue = {};
+    };
+
+    /**
+     * Registers a __cdecl function is allowed to clobber (eax, ecx and edx) and the flags.
+     * The function itself preserves ebx, esi, edi, ebp and esp.
+     */
+    struct TrampolineSaveCdecl {
+        static constexpr std::array<std::uint8_t, 4> prologue = {
+            0x9C,   // pushfd
+            0x50,   // push eax
+            0x51,   // push ecx
+            0x52    // push edx
+        };
+        static constexpr std::array<std::uint8_t, 4> epilogue = {
+            0x5A,   // pop edx
+            0x59,   // pop ecx
+            0x58,   // pop eax
+            0x9D    // popfd
+        };
+    };
+
+    /**
+     * Every general purpose register and the flags.
+     * Needed by assembly functions that read or write the registers of the hooked code through the pushad frame.
+     */
+    struct TrampolineSaveAll {
+        static constexpr std::array<std::uint8_t, 2> prologue = {
+            0x9C,   // pushfd
+            0x60    // pushad
+        };
+        static constexpr std::array<std::uint8_t, 2> epilogue = {
+            0x61,   // popad
+            0x9D    // popfd
+        };
+    };
+
+    /**
+     * Get the size of a trampoline.
+     * @param save_result   Store the result of the function
+     */
+    template<typename Registers>
+    constexpr std::size_t trampoline_size(bool save_result) noexcept {
+        return Registers::prologue.size() + 5 + (save_result ? 5 : 0) + Registers::epilogue.size();
+    }
+
+    static_assert(trampoline_size<TrampolineSaveNothing>(false) == 5);
+    static_assert(trampoline_size<TrampolineSaveAll>(false) == 9);
+}
+
+#endif
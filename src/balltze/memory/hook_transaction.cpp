@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <windows.h>
+#include <tlhelp32.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+#include <balltze/memory.hpp>
+#include <balltze/hook.hpp>
+
+#define MAX_THREAD_SUSPEND_ATTEMPTS 16
+
+namespace Balltze::Memory {
+    struct PatchedCode {
+        /** Hook the code belongs to */
+        Hook *hook;
+
+        /** Code to write */
+        std::vector<std::byte> code;
+    };
+
+    struct ProtectedRegion {
+        std::byte *address;
+        std::size_t size;
+        DWORD original_protection;
+    };
+
+    static void resume_threads(std::vector<HANDLE> &threads) noexcept {
+        for(auto thread : threads) {
+            ResumeThread(thread);
+            CloseHandle(thread);
+        }
+        threads.clear();
+    }
+
+    /**
+     * Suspend every thread of the process but the current one.
+     * The vector is reserved before the first thread is suspended, since a suspended thread may hold the heap lock.
+     */
+    static void suspend_other_threads(std::vector<HANDLE> &threads) {
+        auto snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
+        if(snapshot == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Failed to list game threads");
+        }
+
+        auto process_id = GetCurrentProcessId();
+        auto current_thread_id = GetCurrentThreadId();
+        THREADENTRY32 entry;
+        entry.dwSize = sizeof(entry);
+
+        std::size_t thread_count = 0;
+        if(Thread32First(snapshot, &entry)) {
+            do {
+                if(entry.th32OwnerProcessID == process_id && entry.th32ThreadID != current_thread_id) {
+                    thread_count++;
+                }
+            } while(Thread32Next(snapshot, &entry));
+        }
+        try {
+            threads.reserve(thread_count);
+        }
+        catch(std::bad_alloc &) {
+            CloseHandle(snapshot);
+            throw;
+        }
+
+        entry.dwSize = sizeof(entry);
+        if(Thread32First(snapshot, &entry)) {
+            do {
+                if(entry.th32OwnerProcessID != process_id || entry.th32ThreadID == current_thread_id) {
+                    continue;
+                }
+                if(threads.size() == threads.capacity()) {
+                    break;
+                }
+                auto thread = OpenThread(THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT, FALSE, entry.th32ThreadID);
+                if(!thread) {
+                    continue;
+                }
+                if(SuspendThread(thread) == static_cast<DWORD>(-1)) {
+                    CloseHandle(thread);
+                    continue;
+                }
+                threads.push_back(thread);
+            } while(Thread32Next(snapshot, &entry));
+        }
+        CloseHandle(snapshot);
+    }
+
+    /**
+     * Check if any of the given threads stopped in the middle of the code to patch.
+     */
+    static bool threads_in_patched_code(const std::vector<HANDLE> &threads, const std::vector<PatchedCode> &patches) noexcept {
+        for(auto thread : threads) {
+            CONTEXT context;
+            context.ContextFlags = CONTEXT_CONTROL;
+            if(!GetThreadContext(thread, &context)) {
+                continue;
+            }
+            auto *instruction_pointer = reinterpret_cast<std::byte *>(context.Eip);
+            for(auto &patch : patches) {
+                auto *address = patch.hook->address();
+                if(instruction_pointer > address && instruction_pointer < address + patch.code.size()) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Get the pages of every patch, split in regions of pages with the same protection.
+     */
+    static std::vector<ProtectedRegion> get_patched_regions(const std::vector<PatchedCode> &patches) {
+        SYSTEM_INFO system_info;
+        GetSystemInfo(&system_info);
+        std::uintptr_t page_size = system_info.dwPageSize;
+
+        std::vector<std::pair<std::uintptr_t, std::uintptr_t>> page_ranges;
+        for(auto &patch : patches) {
+            auto begin = reinterpret_cast<std::uintptr_t>(patch.hook->address());
+            auto end = begin + patch.code.size();
+            page_ranges.emplace_back(begin / page_size * page_size, (end + page_size - 1) / page_size * page_size);
+        }
+
+        // Merge overlapping and adjacent ranges
+        std::sort(page_ranges.begin(), page_ranges.end());
+        std::vector<std::pair<std::uintptr_t, std::uintptr_t>> merged_ranges;
+        for(auto &range : page_ranges) {
+            if(!merged_ranges.empty() && range.first <= merged_ranges.back().second) {
+                merged_ranges.back().second = std::max<std::uintptr_t>(merged_ranges.back().second, range.second);
+            }
+            else {
+                merged_ranges.push_back(range);
+            }
+        }
+
+        std::vector<ProtectedRegion> regions;
+        for(auto &range : merged_ranges) {
+            auto address = range.first;
+            while(address < range.second) {
+                MEMORY_BASIC_INFORMATION info;
+                if(VirtualQuery(reinterpret_cast<void *>(address), &info, sizeof(info)) == 0) {
+                    throw std::runtime_error("Failed to query the protection of the code to patch");
+                }
+                auto region_end = std::min<std::uintptr_t>(range.second, reinterpret_cast<std::uintptr_t>(info.BaseAddress) + info.RegionSize);
+                regions.push_back({ reinterpret_cast<std::byte *>(address), region_end - address, 0 });
+                address = region_end;
+            }
+        }
+        return regions;
+    }
+
+    /**
+     * Make the given regions writable; nothing is allocated, so other threads may be suspended.
+     * @return  False if any region could not be changed; the ones that were are put back
+     */
+    static bool unprotect_pages(std::vector<ProtectedRegion> &regions) noexcept {
+        for(std::size_t i = 0; i < regions.size(); i++) {
+            auto &region = regions[i];
+            if(!VirtualProtect(region.address, region.size, PAGE_EXECUTE_READWRITE, &region.original_protection)) {
+                for(std::size_t j = 0; j < i; j++) {
+                    DWORD old_protection;
+                    VirtualProtect(regions[j].address, regions[j].size, regions[j].original_protection, &old_protection);
+                }
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void protect_pages(const std::vector<ProtectedRegion> &regions) noexcept {
+        for(auto &region : regions) {
+            if(region.original_protection != PAGE_EXECUTE_READWRITE) {
+                DWORD old_protection;
+                VirtualProtect(region.address, region.size, region.original_protection, &old_protection);
+            }
+        }
+    }
+
+    void HookTransaction::add(Hook *hook) {
+        if(!hook) {
+            throw std::invalid_argument("hook must be a valid hook");
+        }
+        for(auto *added_hook : m_hooks) {
+            if(added_hook->address() == hook->address()) {
+                throw std::invalid_argument("address is already in the transaction");
+            }
+        }
+        m_hooks.push_back(hook);
+    }
+
+    std::size_t HookTransaction::size() const noexcept {
+        return m_hooks.size();
+    }
+
+    void HookTransaction::apply(bool install, bool suspend_threads) {
+        // Build and check the code of every hook first, so nothing is written if any of them is not valid
+        std::vector<PatchedCode> patches;
+        for(auto *hook : m_hooks) {
+            if(hook->m_hooked == install) {
+                continue;
+            }
+
+            PatchedCode patch;
+            patch.hook = hook;
+            if(install) {
+                if(hook->m_cave.empty()) {
+                    char message[256];
+                    snprintf(message, sizeof(message), "hook at 0x%p has no code", hook->m_instruction);
+                    throw std::runtime_error(message);
+                }
+
+                // Same code Hook::hook() writes; a jmp to the cave padded with nops
+                patch.code.resize(std::max<std::size_t>(hook->m_original_code.size(), 5), static_cast<std::byte>(0x90));
+                patch.code[0] = static_cast<std::byte>(0xE9);
+                auto offset = calculate_32bit_jump(hook->m_instruction, hook->m_cave.data());
+                std::memcpy(patch.code.data() + 1, &offset, sizeof(offset));
+
+                // Something else patched this code after the hook copied it
+                if(!hook->m_original_code.empty() && std::memcmp(hook->m_instruction, hook->m_original_code.data(), hook->m_original_code.size()) != 0) {
+                    char message[256];
+                    snprintf(message, sizeof(message), "code at 0x%p changed since the hook was built", hook->m_instruction);
+                    throw std::runtime_error(message);
+                }
+            }
+            else {
+                patch.code = hook->m_original_code;
+            }
+            patches.push_back(std::move(patch));
+        }
+
+        if(patches.empty()) {
+            return;
+        }
+
+        // Everything that allocates is done before suspending, since a suspended thread may hold the heap lock
+        auto regions = get_patched_regions(patches);
+
+        // Make sure no thread is halfway through the code we are about to replace
+        std::vector<HANDLE> suspended_threads;
+        if(suspend_threads) {
+            for(std::size_t attempt = 0;; attempt++) {
+                suspend_other_threads(suspended_threads);
+                if(!threads_in_patched_code(suspended_threads, patches)) {
+                    break;
+                }
+                resume_threads(suspended_threads);
+                if(attempt + 1 == MAX_THREAD_SUSPEND_ATTEMPTS) {
+                    throw std::runtime_error("Failed to suspend game threads outside of the code to patch");
+                }
+                Sleep(1);
+            }
+        }
+
+        if(!unprotect_pages(regions)) {
+            resume_threads(suspended_threads);
+            throw std::runtime_error("Failed to make the code to patch writable");
+        }
+
+        // Nothing can fail past this point
+        for(auto &patch : patches) {
+            std::memcpy(patch.hook->m_instruction, patch.code.data(), patch.code.size());
+        }
+
+        protect_pages(regions);
+
+        auto lowest = std::min_element(patches.begin(), patches.end(), [](auto &a, auto &b) { return a.hook->m_instruction < b.hook->m_instruction; });
+        auto highest = std::max_element(patches.begin(), patches.end(), [](auto &a, auto &b) { return a.hook->m_instruction + a.code.size() < b.hook->m_instruction + b.code.size(); });
+        auto *flush_begin = lowest->hook->m_instruction;
+        auto *flush_end = highest->hook->m_instruction + highest->code.size();
+        FlushInstructionCache(GetCurrentProcess(), flush_begin, flush_end - flush_begin);
+
+        resume_threads(suspended_threads);
+
+        for(auto &patch : patches) {
+            patch.hook->m_hooked = install;
+        }
+    }
+
+    void HookTransaction::commit(bool suspend_threads) {
+        apply(true, suspend_threads);
+    }
+
+    void HookTransaction::revert(bool suspend_threads) {
+        apply(false, suspend_threads);
+    }
+}
@@ -3,8 +3,18 @@
 #ifndef BALLTZE__MEMORY__MEMORY_HPP
 #define BALLTZE__MEMORY__MEMORY_HPP
 
+#include <balltze/memory.hpp>
+#include "signature_table.hpp"
+
 namespace Balltze::Memory {
     BalltzeSide find_signatures();
+
+    /**
+     * Get a signature of the game executable
+     * @param id    Signature ID
+     * @return      Pointer to the signature if it was found, nullptr if not
+     */
+    Signature const *get_signature(SignatureId id) noexcept;
 }
 
 #endif
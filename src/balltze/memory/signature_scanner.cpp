@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include "signature_scanner.hpp"
+
+namespace Balltze::Memory {
+    std::size_t SignatureScanner::add_pattern(const short *pattern, std::size_t length, std::size_t match_num) {
+        return add_pattern(BytePattern(pattern, length), match_num);
+    }
+
+    std::size_t SignatureScanner::add_pattern(BytePattern pattern, std::size_t match_num) {
+        m_patterns.push_back({ std::move(pattern), match_num, std::nullopt, false });
+        return m_patterns.size() - 1;
+    }
+
+    bool SignatureScanner::resolve(std::size_t pattern, const std::byte *memory, std::size_t length, std::size_t offset) noexcept {
+        if(pattern >= m_patterns.size()) {
+            return false;
+        }
+
+        auto &entry = m_patterns[pattern];
+        if(offset > length || length - offset < entry.pattern.size()) {
+            return false;
+        }
+        if(!entry.pattern.matches_at(reinterpret_cast<const std::uint8_t *>(memory) + offset)) {
+            return false;
+        }
+        entry.result = offset;
+        return true;
+    }
+
+    void SignatureScanner::discard(std::size_t pattern) noexcept {
+        if(pattern < m_patterns.size()) {
+            m_patterns[pattern].result = std::nullopt;
+            m_patterns[pattern].discarded = true;
+        }
+    }
+
+    void SignatureScanner::scan_range(const std::vector<std::size_t> &pending, const std::uint8_t *memory, std::size_t length, std::size_t begin, std::size_t end, std::vector<std::vector<std::size_t>> &matches) const {
+        std::array<std::vector<std::size_t>, 256> buckets;
+        std::size_t max_anchor = 0;
+        std::size_t remaining = 0;
+
+        matches.assign(pending.size(), {});
+        for(std::size_t p = 0; p < pending.size(); p++) {
+            auto &pattern = m_patterns[pending[p]];
+            auto anchor = *pattern.pattern.anchor();
+            buckets[pattern.pattern.values()[anchor]].push_back(p);
+            max_anchor = std::max(max_anchor, anchor);
+            remaining++;
+        }
+
+        // Matches starting in [begin, end) may have their anchor byte past the end of the range
+        auto scan_end = std::min(length, end + max_anchor);
+        for(std::size_t offset = begin; offset < scan_end && remaining > 0; offset++) {
+            auto &bucket = buckets[memory[offset]];
+            std::size_t b = 0;
+            while(b < bucket.size()) {
+                auto p = bucket[b];
+                auto &pattern = m_patterns[pending[p]];
+                auto anchor = *pattern.pattern.anchor();
+
+                if(offset >= anchor) {
+                    auto start = offset - anchor;
+                    if(start >= begin && start < end && start + pattern.pattern.size() <= length && pattern.pattern.matches_at(memory + start)) {
+                        matches[p].push_back(start);
+                        if(matches[p].size() > pattern.match_num) {
+                            // Stop looking for this one; the swapped-in pattern is checked in this same position
+                            bucket[b] = bucket.back();
+                            bucket.pop_back();
+                            remaining--;
+                            continue;
+                        }
+                    }
+                }
+                b++;
+            }
+        }
+    }
+
+    void SignatureScanner::scan(const std::byte *memory, std::size_t length, std::size_t threads) {
+        auto *bytes = reinterpret_cast<const std::uint8_t *>(memory);
+        std::vector<std::size_t> pending;
+
+        for(std::size_t i = 0; i < m_patterns.size(); i++) {
+            auto &pattern = m_patterns[i];
+            if(pattern.result || pattern.discarded) {
+                continue;
+            }
+
+            // A pattern made only of wildcards matches anywhere
+            if(!pattern.pattern.anchor()) {
+                if(pattern.match_num + pattern.pattern.size() <= length) {
+                    pattern.result = pattern.match_num;
+                }
+                continue;
+            }
+
+            pending.push_back(i);
+        }
+
+        if(pending.empty()) {
+            return;
+        }
+
+        // Split the memory in chunks; a chunk owns the matches starting inside it
+        std::size_t chunk_count = std::clamp<std::size_t>(std::min(threads, length / MIN_CHUNK_SIZE), 1, MAX_SCAN_THREADS);
+        std::size_t chunk_size = (length + chunk_count - 1) / chunk_count;
+        std::vector<std::vector<std::vector<std::size_t>>> chunk_matches(chunk_count);
+
+        std::vector<std::exception_ptr> chunk_errors(chunk_count);
+        auto scan_chunk = [&](std::size_t c) {
+            auto begin = c * chunk_size;
+            auto end = std::min(length, begin + chunk_size);
+            try {
+                scan_range(pending, bytes, length, begin, end, chunk_matches[c]);
+            }
+            catch(...) {
+                chunk_errors[c] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(chunk_count - 1);
+        std::size_t c = 1;
+        try {
+            for(; c < chunk_count; c++) {
+                workers.emplace_back(scan_chunk, c);
+            }
+        }
+        catch(std::system_error &) {
+            // Out of threads; the chunks that did not get one are scanned here
+        }
+
+        scan_chunk(0);
+        for(; c < chunk_count; c++) {
+            scan_chunk(c);
+        }
+        for(auto &worker : workers) {
+            worker.join();
+        }
+        for(auto &error : chunk_errors) {
+            if(error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        // Merge chunks in order; each one keeps up to match_num + 1 matches, so the result is the same as a serial scan
+        for(std::size_t p = 0; p < pending.size(); p++) {
+            auto &pattern = m_patterns[pending[p]];
+            std::size_t skipped = 0;
+            for(auto &matches : chunk_matches) {
+                if(skipped + matches[p].size() > pattern.match_num) {
+                    pattern.result = matches[p][pattern.match_num - skipped];
+                    break;
+                }
+                skipped += matches[p].size();
+            }
+        }
+    }
+
+    std::optional<std::size_t> SignatureScanner::match(std::size_t pattern) const noexcept {
+        if(pattern >= m_patterns.size()) {
+            return std::nullopt;
+        }
+        return m_patterns[pattern].result;
+    }
+
+    const BytePattern &SignatureScanner::pattern(std::size_t pattern) const {
+        return m_patterns.at(pattern).pattern;
+    }
+
+    std::size_t SignatureScanner::pattern_length(std::size_t pattern) const noexcept {
+        if(pattern >= m_patterns.size()) {
+            return 0;
+        }
+        return m_patterns[pattern].pattern.size();
+    }
+
+    std::size_t SignatureScanner::size() const noexcept {
+        return m_patterns.size();
+    }
+}
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__MEMORY__SIGNATURE_SCANNER_HPP
+#define BALLTZE__MEMORY__SIGNATURE_SCANNER_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "byte_pattern.hpp"
+
+#define MIN_CHUNK_SIZE 0x40000
+#define MAX_SCAN_THREADS 16
+
+namespace Balltze::Memory {
+    /**
+     * Multi-pattern signature scanner.
+     * Every registered pattern is resolved in a single pass over the scanned memory. Patterns are
+     * bucketed by their first non-wildcard byte, so each position of the buffer is only compared
+     * against the patterns that could start there.
+     */
+    class SignatureScanner {
+    public:
+        /**
+         * Register a pattern to be resolved on the next scan.
+         * @param pattern   Pattern bytes; -1 is a wildcard
+         * @param length    Number of bytes
+         * @param match_num Index of the match to resolve
+         * @return          Pattern index
+         * @throws std::invalid_argument if the pattern is empty or has invalid bytes
+         */
+        std::size_t add_pattern(const short *pattern, std::size_t length, std::size_t match_num = 0);
+
+        /**
+         * Register a pattern to be resolved on the next scan.
+         * @param pattern   Pattern to find
+         * @param match_num Index of the match to resolve
+         * @return          Pattern index
+         */
+        std::size_t add_pattern(BytePattern pattern, std::size_t match_num = 0);
+
+        /**
+         * Resolve a pattern to a known offset if the pattern still matches there.
+         * @param pattern   Pattern index
+         * @param memory    Memory to check
+         * @param length    Size of the memory
+         * @param offset    Offset of the expected match
+         * @return          True if the pattern was resolved
+         */
+        bool resolve(std::size_t pattern, const std::byte *memory, std::size_t length, std::size_t offset) noexcept;
+
+        /**
+         * Mark a pattern as known to be missing, so scans skip it.
+         * @param pattern   Pattern index
+         */
+        void discard(std::size_t pattern) noexcept;
+
+        /**
+         * Resolve every pending pattern walking the given memory once.
+         * Patterns that were already resolved or discarded are skipped.
+         * The memory can be split in chunks scanned by multiple threads; the resolved matches
+         * are the same ones a serial scan would find.
+         * @param memory    Memory to scan
+         * @param length    Size of the memory
+         * @param threads   Maximum number of threads to use; 1 scans serially. Chunks whose thread
+         *                  could not be started are scanned by the calling thread.
+         * @throws std::bad_alloc if the matches do not fit in memory
+         */
+        void scan(const std::byte *memory, std::size_t length, std::size_t threads = 1);
+
+        /**
+         * Get the offset of a resolved pattern from the start of the scanned memory.
+         * @param pattern   Pattern index
+         * @return          Offset of the match, or nothing if it was not found
+         */
+        std::optional<std::size_t> match(std::size_t pattern) const noexcept;
+
+        /**
+         * Get a registered pattern.
+         * @param pattern   Pattern index
+         */
+        const BytePattern &pattern(std::size_t pattern) const;
+
+        /**
+         * Get the length of a registered pattern.
+         * @param pattern   Pattern index
+         */
+        std::size_t pattern_length(std::size_t pattern) const noexcept;
+
+        /**
+         * Get the number of registered patterns.
+         */
+        std::size_t size() const noexcept;
+
+    private:
+        struct Pattern {
+            /** Pattern to match */
+            BytePattern pattern;
+
+            /** Index of the match to resolve */
+            std::size_t match_num;
+
+            /** Offset of the resolved match */
+            std::optional<std::size_t> result;
+
+            /** Is the pattern known to be missing? */
+            bool discarded;
+        };
+
+        /** Registered patterns */
+        std::vector<Pattern> m_patterns;
+
+        /**
+         * Find up to match_num + 1 matches of the given patterns starting in [begin, end).
+         * @param pending   Indices of the patterns to look for
+         * @param memory    Memory to scan
+         * @param length    Size of the memory
+         * @param begin     First start position to check
+         * @param end       End of the range of start positions
+         * @param matches   Matches of every pending pattern, in order
+         */
+        void scan_range(const std::vector<std::size_t> &pending, const std::uint8_t *memory, std::size_t length, std::size_t begin, std::size_t end, std::vector<std::vector<std::size_t>> &matches) const;
+    };
+}
+
+#endif
@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <algorithm>
+#include "signature_table.hpp"
+
+namespace Balltze::Memory {
+    /**
+     * Patterns are hexadecimal bytes; "??" is a wildcard. Bytes that may have been patched by
+     * other mods before we scan the executable must be wildcards.
+     */
+    static constexpr SignatureDefinition signature_definitions[] = {
+        /** Core */
+        { SIGNATURE_CONSOLE_OUT, "console_out", SIGNATURE_GROUP_CORE, 0x0, "83 EC 10 57 8B F8 A0 ?? ?? ?? ?? 84 C0 C7 44 24 04 00 00 80 3F" },
+        { SIGNATURE_ENGINE_TYPE, "engine_type", SIGNATURE_GROUP_CORE, 0x4, "8D 75 D0 B8 ?? ?? ?? ?? E8 ?? ?? ?? ?? 83" },
+        { SIGNATURE_HALO_PATH, "halo_path", SIGNATURE_GROUP_CORE, 0x1, "BF ?? ?? ?? ?? F3 AB AA E8" },
+        { SIGNATURE_RESOLUTION, "resolution", SIGNATURE_GROUP_CORE, 0x4, "75 0A 66 A1 ?? ?? ?? ?? 66 89 42 04 83 C4 10 C3" },
+        { SIGNATURE_TICK_COUNTER, "tick_counter", SIGNATURE_GROUP_CORE, 0x1, "A1 ?? ?? ?? ?? 66 89 58 10 66 8B 0D ?? ?? ?? ?? 66 83 F9 01" },
+        { SIGNATURE_TICK_RATE, "tick_rate", SIGNATURE_GROUP_CORE, 0x2, "D8 0D ?? ?? ?? ?? 83 EC 08 D9 5C 24 08 D9 44 24 14 D8 41 1C" },
+        { SIGNATURE_SERVER_TYPE, "server_type", SIGNATURE_GROUP_CORE, 0x0, "0F BF 2D ?? ?? ?? ?? E8 ?? ?? ?? ?? 39 1D ?? ?? ?? ?? 75 05" },
+        { SIGNATURE_CURRENT_GAMETYPE, "current_gametype", SIGNATURE_GROUP_CORE, 0x0, "83 3D ?? ?? ?? ?? 04 8B 4F 6C 89 4C 24 34 75" },
+        { SIGNATURE_MAP_INDEX, "map_index", SIGNATURE_GROUP_CORE, 0xA, "3B 05 ?? ?? ?? ?? 7D ?? 8B 0D ?? ?? ?? ??" },
+        { SIGNATURE_GET_TAG_HANDLE, "get_tag_handle", SIGNATURE_GROUP_CORE, 0x0, "A0 ?? ?? ?? ?? 53 83 CB FF 84 C0 55 8B 6C 24 0C 74 5B A1 ?? ?? ?? ?? 8B 48 0C" },
+        { SIGNATURE_ON_TICK, "on_tick", SIGNATURE_GROUP_CORE, 0x0, "?? ?? ?? ?? ?? A1 ?? ?? ?? ?? 8B 50 14 8B 48 0C" }, // byte 0 may be patched (E8)
+        { SIGNATURE_ON_FRAME, "on_frame", SIGNATURE_GROUP_CORE, 0x0, "?? ?? ?? ?? ?? 83 C4 08 89 3D" }, // byte 0 may be patched (E8)
+
+        /** Map loading */
+        { SIGNATURE_ON_MAP_LOAD, "on_map_load", SIGNATURE_GROUP_CORE, 0x0, "E8 ?? ?? ?? ?? E8 ?? ?? ?? ?? A1 ?? ?? ?? ?? 33 D2 8B C8 89 11" },
+        { SIGNATURE_MAP_HEADER, "map_header", SIGNATURE_GROUP_CORE, 0x2, "81 3D ?? ?? ?? ?? ?? ?? ?? ?? 8B 3D" },
+        { SIGNATURE_MAP_LOAD_PATH, "map_load_path", SIGNATURE_GROUP_CORE, 0x0, "?? ?? ?? ?? ?? A1 ?? ?? ?? ?? 83 C4 ?? 85 C0 BF 80 00 00 48" }, // byte 0 may be patched (E8)
+        { SIGNATURE_READ_MAP_FILE_DATA, "read_map_file_data", SIGNATURE_GROUP_CORE, 0x0, "?? ?? ?? ?? ?? FF 54 24 ?? 85 C0 75 29" }, // bytes 0-4 may be patched (57 56 53 55 50)
+        { SIGNATURE_READ_MAP_FILE_DATA_CALL_1, "read_map_file_data_call_1", SIGNATURE_GROUP_CORE, 0x0, "E8 ?? ?? ?? ?? 83 C4 0C 8D 74 24 13 E8 ?? ?? ?? ?? 8A 44 24 13" },
+        { SIGNATURE_READ_MAP_FILE_DATA_CALL_2, "read_map_file_data_call_2", SIGNATURE_GROUP_CORE, 0x9, "BF ?? ?? ?? ?? C6 46 1E 01 E8 ?? ?? ?? ?? 83 C4 0C E9 ?? ?? ?? ??" },
+        { SIGNATURE_LOAD_MAP_FUNCTION, "load_map_function", SIGNATURE_GROUP_CORE, 0x0, "53 32 DB E8 ?? ?? ?? ?? 83 F8 FF A3 ?? ?? ?? ?? 0F 84 9F 00 00 00" },
+
+        /** Input */
+        { SIGNATURE_KEYPRESS_EVENT, "keypress_event", SIGNATURE_GROUP_CORE, 0x0, "89 0C 85 ?? ?? ?? ?? 66 FF 05 ?? ?? ?? ?? 59 C3" },
+        { SIGNATURE_KEYBOARD_INPUT, "keyboard_input", SIGNATURE_GROUP_CORE, 0x0, "81 FE FF 7F 00 00 74 32 66 3B F3 7C 27 66 83 FE 1D" },
+        { SIGNATURE_MOUSE_INPUT, "mouse_input", SIGNATURE_GROUP_CORE, 0x0, "81 FD FF 7F 00 00 74 32 66 3B EF 7C 27 66 83 FD 1D" },
+        { SIGNATURE_GAMEPAD_INPUT, "gamepad_input", SIGNATURE_GROUP_CORE, 0x0, "81 FD FF 7F 00 00 74 3D 66 85 ED 7C 2E 66 83 FD 1D" },
+        { SIGNATURE_GET_BUTTON_NAME_FUNCTION, "get_button_name_function", SIGNATURE_GROUP_CORE, 0x0, "53 8B D9 0F BF 08 49 0F 84 8F 00 00 00 49" },
+        { SIGNATURE_CONTROLS_STRUCT_ADDRESS, "controls_struct_address", SIGNATURE_GROUP_CORE, 0xB, "0F BF CE 8A 14 01 0F B6 C2 88 85 ?? ?? ?? ??" },
+        { SIGNATURE_KEYBOARD_KEYS_STRUCT_ADDRESS, "keyboard_keys_struct_address", SIGNATURE_GROUP_CORE, 0x1, "B8 ?? ?? ?? ?? BA 6D 00 00 00 8D 49 00 80 ?? 6D 01 75 05" },
+
+        /** User interface */
+        { SIGNATURE_SINGLEPLAYER_PAUSE_MENU_TAG_PATH, "singleplayer_pause_menu_tag_path", SIGNATURE_GROUP_CORE, 0x1, "68 ?? ?? ?? ?? E8 ?? ?? ?? ?? 83 C4 1C C6 44 24 12 01 5F 5E" },
+        { SIGNATURE_MULTIPLAYER_PAUSE_MENU_TAG_PATH, "multiplayer_pause_menu_tag_path", SIGNATURE_GROUP_CORE, 0x1, "B8 ?? ?? ?? ?? 6A FF 50 E9 A7 00 00 00 6A FF" },
+        { SIGNATURE_WIDGET_GLOBALS, "widget_globals", SIGNATURE_GROUP_CORE, 0x8, "33 C0 B9 0D 00 00 00 BF ?? ?? ?? ?? F3 AB 39 1D" },
+        { SIGNATURE_WIDGET_EVENT_GLOBALS, "widget_event_globals", SIGNATURE_GROUP_CORE, 0x8, "33 C0 B9 43 00 00 00 BF ?? ?? ?? ?? F3 AB 8D 44 24 04" },
+        { SIGNATURE_WIDGET_CURSOR_GLOBALS, "widget_cursor_globals", SIGNATURE_GROUP_CORE, 0x4, "8B C6 C6 05 ?? ?? ?? ?? 01 E8 ?? ?? ?? ?? 83 C4 04 C6 05 ?? ?? ?? ?? 00" },
+        { SIGNATURE_WIDGET_CREATE_FUNCTION, "widget_create_function", SIGNATURE_GROUP_CORE, 0x0, "83 EC 0C 53 8B 5C 24 20 55 33 C0 33 ED 66 83 FB FF" },
+        { SIGNATURE_WIDGET_OPEN_FUNCTION, "widget_open_function", SIGNATURE_GROUP_CORE, 0x0, "8B 0D ?? ?? ?? ?? 8B 54 24 04 53 55 8B 6C 24 10 8B C5 25 FF FF 00 00" },
+        { SIGNATURE_WIDGET_BACK_FUNCTION, "widget_back_function", SIGNATURE_GROUP_CORE, 0x0, "83 EC 10 53 8B D8 33 C0 66 8B 43 08 33 C9 66 3D FF FF" },
+        { SIGNATURE_WIDGET_FIND_FUNCTION, "widget_find_function", SIGNATURE_GROUP_CORE, 0x0, "8B 4C 24 04 8B 11 57 8B 7C 24 0C 33 C0 3B D7 75 04" },
+        { SIGNATURE_WIDGET_FOCUS_FUNCTION, "widget_focus_function", SIGNATURE_GROUP_CORE, 0x0, "55 56 8B F1 8B 48 30 85 C9 74 0E EB 03 8D 49 00" },
+        { SIGNATURE_WIDGET_LIST_ITEM_INDEX_FUNCTION, "widget_list_item_index_function", SIGNATURE_GROUP_CORE, 0x0, "8B 4E 30 83 C8 FF 85 C9 74 18 8B 49 34 33 D2" },
+        { SIGNATURE_WIDGET_MEMORY_RELEASE_FUNCTION, "widget_memory_release_function", SIGNATURE_GROUP_CORE, 0x0, "51 57 8B 7C 24 0C 8A 47 14 84 C0 0F 85 ?? ?? ?? ?? 66 8B 47 08" },
+
+        /** Game state */
+        { SIGNATURE_CAMERA_COORD, "camera_coord", SIGNATURE_GROUP_CORE, 0x2, "D9 05 ?? ?? ?? ?? 83 EC 18 DD 5C 24 10" },
+        { SIGNATURE_CAMERA_TYPE, "camera_type", SIGNATURE_GROUP_CORE, 0x2, "81 C1 ?? ?? ?? ?? 8B 41 08 3D ?? ?? ?? ?? 75 1D D9 05" },
+        { SIGNATURE_ANTENNA_TABLE_ADDRESS, "antenna_table_address", SIGNATURE_GROUP_CORE, 0x2, "8B 15 ?? ?? ?? ?? 8B C7 25 FF FF 00 00 C1 E0 05 55 8B 6C 08 14 89 6C 24 28" },
+        { SIGNATURE_OBJECT_TABLE_ADDRESS, "object_table_address", SIGNATURE_GROUP_CORE, 0x2, "8B 0D ?? ?? ?? ?? 8B 51 34 25 FF FF 00 00 8D" },
+        { SIGNATURE_DELETE_OBJECT_FUNCTION, "delete_object_function", SIGNATURE_GROUP_CORE, 0x0, "8B F8 25 FF FF 00 00 8D 04 40 8B 44 82 08 8B 40 04" },
+        { SIGNATURE_CREATE_OBJECT_FUNCTION, "create_object_function", SIGNATURE_GROUP_CORE, 0x0, "56 83 CE FF 85 C9 57" },
+        { SIGNATURE_CREATE_OBJECT_QUERY_FUNCTION, "create_object_query_function", SIGNATURE_GROUP_CORE, 0x0, "53 8B 5C 24 0C 56 8B F0 33 C0" },
+        { SIGNATURE_APPLY_DAMAGE_FUNCTION, "apply_damage_function", SIGNATURE_GROUP_CORE, 0x0, "81 EC 94 00 00 00 8B 84 24 9C 00 00 00 25 FF FF 00 00" },
+        { SIGNATURE_FLAG_TABLE_ADDRESS, "flag_table_address", SIGNATURE_GROUP_CORE, 0x2, "8B 3D ?? ?? ?? ?? 83 C4 0C 8D 4E 01 83 CB FF 66 85 C9 7C 31" },
+        { SIGNATURE_LIGHT_TABLE_ADDRESS, "light_table_address", SIGNATURE_GROUP_CORE, 0x2, "8B 0D ?? ?? ?? ?? 8B 51 34 56 8B F0 81 E6 FF FF 00 00 6B F6 7C" },
+        { SIGNATURE_PLAYER_HANDLE_ADDRESS, "player_handle_address", SIGNATURE_GROUP_CORE, 0x2, "8B 0D ?? ?? ?? ?? C1 F8 05 23 54 81 18" },
+        { SIGNATURE_PLAYER_TABLE_ADDRESS, "player_table_address", SIGNATURE_GROUP_CORE, 0x1, "A1 ?? ?? ?? ?? 89 44 24 48 35" },
+        { SIGNATURE_UNIT_ENTER_VEHICLE_FUNCTION, "unit_enter_vehicle_function", SIGNATURE_GROUP_CORE, 0x0, "55 8B EC 83 E4 F8 81 EC DC 00 00 00 53 56 8B 75 08 57 83 CF FF 3B F7 0F 84 20 05 00 00" },
+        { SIGNATURE_UNIT_EXIT_VEHICLE_FUNCTION, "unit_exit_vehicle_function", SIGNATURE_GROUP_CORE, 0x0, "55 8B EC 83 E4 F8 81 EC DC 00 00 00 53 56 8B F0 83 C9 FF 3B F1 57" },
+        { SIGNATURE_GET_NUMERIC_COUNTDOWN_TIMER_FUNCTION, "get_numeric_countdown_timer_function", SIGNATURE_GROUP_CORE, 0x0, "0F BF C0 33 D2 40 83 F8 09 0F 87 36 01 00 00" },
+        { SIGNATURE_EXECUTE_SCRIPT_FUNCTION, "execute_script_function", SIGNATURE_GROUP_CORE, 0x0, "81 EC 0C 08 00 00 53 55 8B AC 24 18 08 00 00 68 00 04 00 00" },
+
+        /** Commands */
+        { SIGNATURE_EXECUTE_CONSOLE_COMMAND_SAPP_LOADER_HOOK, "execute_console_command_sapp_loader_hook", SIGNATURE_GROUP_CORE, 0x0, "8D 4C 24 08 51 68 ?? ?? ?? ?? 53 E8 ?? ?? ?? ?? 83 C4 0C" },
+        { SIGNATURE_CONSOLE_UNKNOWN_COMMAND_MESSAGE_PRINT_CALL, "console_unknown_command_message_print_call", SIGNATURE_GROUP_CORE, 0x0, "E8 ?? ?? ?? ?? 83 C4 0C 5E 8A C3 5B 81 C4 00 05 00 00" },
+        { SIGNATURE_CONSOLE_TAB_COMPLETION_FUNCTION_CALL, "console_tab_completion_function_call", SIGNATURE_GROUP_CORE, 0x0, "?? ?? ?? ?? ?? 83 C4 08 8B E8 66 85 ED" }, // byte 0 may be patched (E8)
+        { SIGNATURE_COMMAND_LIST_ADDRESS_CUSTOM_EDITION, "command_list_address_custom_edition", SIGNATURE_GROUP_CORE, 0x1, "BB ?? ?? ?? ?? BD ?? ?? ?? ?? 8B FF 8B 33 8A ?? 18" },
+        { SIGNATURE_HELP_COMMAND_FUNCTION_COMMAND_LIST_ADDRESS_1, "help_command_function_command_list_address_1", SIGNATURE_GROUP_CORE, 0x3, "8B 14 8D ?? ?? ?? ?? 8B 4A 10 83 C4 04 8D 54 24 04 8D 49 00" },
+        { SIGNATURE_HELP_COMMAND_FUNCTION_COMMAND_LIST_ADDRESS_2, "help_command_function_command_list_address_2", SIGNATURE_GROUP_CORE, 0x3, "8B 2C 85 ?? ?? ?? ?? 56 8B D9 8B 4D 04 57 51" },
+        { SIGNATURE_FIND_CONSOLE_COMMAND_ENTRY_FUNCTION_COMMAND_LIST_ADDRESS, "find_console_command_entry_function_command_list_address", SIGNATURE_GROUP_CORE, 0x3, "8B 14 8D ?? ?? ?? ?? 8B 42 04 53 50 E8 ?? ?? ?? ??" },
+        { SIGNATURE_FIND_CONSOLE_COMMAND_ENTRY_FUNCTION_COMMAND_LIST_COUNT, "find_console_command_entry_function_command_list_count", SIGNATURE_GROUP_CORE, 0x3, "66 81 FE ?? ?? 7C DD 5F 5E 66 0D FF FF" },
+
+        /** Multiplayer */
+        { SIGNATURE_NETWORK_GAME_CLIENT_SEND_CHAT_MESSAGE_FUNCTION, "network_game_client_send_chat_message_function", SIGNATURE_GROUP_CORE, 0x0, "83 EC 10 8A 4C 24 14 55 6A 00 6A 01 6A 00 88 4C 24 18" },
+        { SIGNATURE_SERVER_INFO_PLAYER_LIST_OFFSET, "server_info_player_list_offset", SIGNATURE_GROUP_CORE, 0x4, "66 0F BE 8A ?? ?? ?? ?? 66 39 8A" },
+        { SIGNATURE_SERVER_INFO_HOST, "server_info_host", SIGNATURE_GROUP_CORE, 0x1, "BF ?? ?? ?? ?? F3 AB A1 ?? ?? ?? ?? BA ?? ?? ?? ?? C7 40 08 ?? ?? ?? ?? E8 ?? ?? ?? ?? 66 8B 0D ?? ?? ?? ?? 66 89 0D ?? ?? ?? ?? B9 FF FF FF FF" },
+        { SIGNATURE_SERVER_INFO_CLIENT, "server_info_client", SIGNATURE_GROUP_CORE, 0x1, "BA ?? ?? ?? ?? E8 ?? ?? ?? ?? 66 A1 ?? ?? ?? ?? 66 25 F9 FF" },
+
+        /** Extended limits */
+        { SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_RESERVE_LOCAL_VARS_SPACE, "read_region_permutation_function_reserve_local_vars_space", SIGNATURE_GROUP_CORE, 0x0, "83 EC 4C 53 25 FF FF 00 00 57 8B F9 8B 0D ?? ?? ?? ?? 8B 51 34" },
+        { SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_FREE_LOCAL_VARS_SPACE, "read_region_permutation_function_free_local_vars_space", SIGNATURE_GROUP_CORE, 0x6, "8A 44 24 13 5E 5D 5F 5B 83 C4 4C C3" },
+        { SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_PARAM_1_READ_1, "read_region_permutation_function_param_1_read_1", SIGNATURE_GROUP_CORE, 0x0, "8B 4C 24 58 8D 04 40 8B 44 82 08 8B 91 C4 00 00 00 33 DB" },
+        { SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_PARAM_1_READ_2, "read_region_permutation_function_param_1_read_2", SIGNATURE_GROUP_CORE, 0x0, "8B 4C 24 60 40 0F BF D8 89 44 24 18" },
+
+        /** Network */
+        { SIGNATURE_NETWORK_GAME_ENCODE_MESSAGE_FUNCTION, "network_game_encode_message_function", SIGNATURE_GROUP_CORE, 0x0, "81 EC A4 00 00 00 53 55 8B AC 24 BC 00 00 00" },
+        { SIGNATURE_NETWORK_GAME_DECODE_MESSAGE_FUNCTION, "network_game_decode_message_function", SIGNATURE_GROUP_CORE, 0x0, "57 8B 38 51 83 C0 04 6A 00 50 E8 ?? ?? ?? ??" },
+        { SIGNATURE_NETWORK_GAME_SERVER_SEND_MESSAGE_TO_ALL_MACHINES_FUNCTION, "network_game_server_send_message_to_all_machines_function", SIGNATURE_GROUP_CORE, 0x0, "83 EC 08 53 55 8B 6C 24 28 56 8B F1 57 8B D8" },
+        { SIGNATURE_NETWORK_GAME_SERVER_SEND_MESSAGE_TO_MACHINE_FUNCTION, "network_game_server_send_message_to_machine_function", SIGNATURE_GROUP_CORE, 0x0, "51 53 57 8B F8 32 C0 33 C9" },
+        { SIGNATURE_NETWORK_GAME_DATA_POINTER, "network_game_data_pointer", SIGNATURE_GROUP_CORE, 0x1, "A1 ?? ?? ?? ?? 3B C3 74 1A 83 C0 08 3B C3 74 13" },
+        { SIGNATURE_NETWORK_GAME_CLIENT_SEND_MESSAGE_FUNCTION, "network_game_client_send_message_function", SIGNATURE_GROUP_CORE, 0x0, "83 EC 0C 8B 4E 10 8B 46 0C 53 8D 04 C1 8B 4E 08" },
+        { SIGNATURE_NETWORK_GAME_CLIENT_UNKNOWN_FUNCTION_1, "network_game_client_unknown_function_1", SIGNATURE_GROUP_CORE, 0x0, "53 55 8B 6C 24 0C 85 ED 56 57 8B F0 8B D9 8B FD" },
+        { SIGNATURE_NETWORK_GAME_CLIENT_PROCESS_RECEIVED_MESSAGE_FUNCTION, "network_game_client_process_received_message_function", SIGNATURE_GROUP_CORE, 0x0, "56 8B F1 66 8B 0D ?? ?? ?? ?? BA 01 00 00 00 66 3B CA" },
+        { SIGNATURE_NETWORK_GAME_CLIENT_DECODE_HUD_MESSAGE_CALL, "network_game_client_decode_hud_message_call", SIGNATURE_GROUP_CORE, 0x0, "?? ?? ?? ?? ?? 84 C0 0F 84 ?? ?? ?? ?? 8A 44 24 10 3C FF" },
+
+        /** Client core */
+        { SIGNATURE_WINDOW_GLOBALS, "window_globals", SIGNATURE_GROUP_CLIENT, 0x4, "8B 45 08 A3 ?? ?? ?? ?? 8B 4D 14" },
+        { SIGNATURE_RCON_MESSAGE_FUNCTION_CALL, "rcon_message_function_call", SIGNATURE_GROUP_CLIENT, 0x0, "68 F4 D5 5F 00 ?? ?? ?? ?? ?? 83 C4 08 83 C4 58 C3 8B C2 E8 ?? ?? ?? ?? 83 C4 58 C3" },
+
+        /** Direct3D */
+        { SIGNATURE_D3D9_CALL_END_SCENE, "d3d9_call_end_scene", SIGNATURE_GROUP_CLIENT, 0x0, "FF 92 A8 00 00 00 85 C0 7C 0C" },
+        { SIGNATURE_D3D9_CALL_RESET, "d3d9_call_reset", SIGNATURE_GROUP_CLIENT, 0x0, "FF 52 40 85 C0 0F 8C" },
+        { SIGNATURE_D3D9_CALL_BEGIN_SCENE, "d3d9_call_begin_scene", SIGNATURE_GROUP_CLIENT, 0x0, "FF 91 A4 00 00 00 85 C0 7D 07 32 C0" },
+        { SIGNATURE_D3D9_RENDER_TARGETS, "d3d9_render_targets", SIGNATURE_GROUP_CLIENT, 0x2, "8B B8 10 8A 63 00 89 4C 24 28 89 44 24 1C 89 7C 24 20" },
+        { SIGNATURE_D3D9_DEVICE_BEHAVIOR_FLAGS, "d3d9_device_behavior_flags", SIGNATURE_GROUP_CLIENT, 0x5, "83 E2 04 03 FA 8B 54 24 28 57 52 8B 15 ?? ?? ?? ??" },
+        { SIGNATURE_D3D9_DEVICE_POINTER, "d3d9_device_pointer", SIGNATURE_GROUP_CLIENT, 0x2, "8B 0D ?? ?? ?? ?? 8B 11 0F BF C0 0F BF F6 8D 3C 76 8D 04 78" },
+
+        /** Map loading */
+        { SIGNATURE_MODEL_DATA_BUFFER_ALLOC, "model_data_buffer_alloc", SIGNATURE_GROUP_CLIENT, 0x0, "FF 15 ?? ?? ?? ?? 8B 4B 20 8B 53 14 57 8B E8" },
+        { SIGNATURE_TAG_DATA_READ_DONE, "tag_data_read_done", SIGNATURE_GROUP_CLIENT, 0x0, "E9 ?? ?? ?? ?? 90 8B 07 A3 ?? ?? ?? ?? A0 ?? ?? ?? ?? 84 C0" },
+        { SIGNATURE_LOAD_MAP_FUNCTION_MULTIPLAYER_CALL, "load_map_function_multiplayer_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 84 C0 74 0A 8B 15 ?? ?? ?? ?? 88 1A" },
+        { SIGNATURE_LOAD_MAP_FUNCTION_SINGLEPLAYER_CALL, "load_map_function_singleplayer_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 33 DB 84 C0 74 0B 8B 0D ?? ?? ?? ?? C6 01 01" },
+
+        /** HUD button icons */
+        { SIGNATURE_HOLD_FOR_WEAPON_HUD_BUTTON_NAME_DRAW, "hold_for_weapon_hud_button_name_draw", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 53 68 ?? ?? ?? ?? 8D 44 24 2C 8D 4C 24 38" },
+        { SIGNATURE_HUD_ICON_MESSAGES_TAG_HANDLE, "hud_icon_messages_tag_handle", SIGNATURE_GROUP_CLIENT, 0x4, "83 EC 10 A1 A4 44 6B 00 8B 88 B0 00 00 00 8A 46 0C 53 55 57" },
+        { SIGNATURE_DRAW_HUD_BITMAP_FUNCTION, "draw_hud_bitmap_function", SIGNATURE_GROUP_CLIENT, 0x0, "83 EC 28 84 C9 56 57 8B F8 8B F2 C7 44 24 10 00 00 00 00" },
+        { SIGNATURE_HOLD_FOR_ACTION_MESSAGE_LEFT_QUOTE_PRINT, "hold_for_action_message_left_quote_print", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 8D 94 24 88 00 00 00 53 52 8D 44 24 24 8D 4C 24 30" },
+        { SIGNATURE_HOLD_FOR_ACTION_MESSAGE_RIGHT_QUOTE_PRINT, "hold_for_action_message_right_quote_print", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 83 C4 18 E9 BF 01 00 00 8B 15 A8 44 6B 00 8A 4A 01" },
+
+        /** User interface */
+        { SIGNATURE_PLAY_SOUND_FUNCTION, "play_sound_function", SIGNATURE_GROUP_CLIENT, 0x0, "83 EC 08 8B 0D ?? ?? ?? ?? 53 55 8B 6C 24 14 8B C5 25 FF FF 00 00 C1 E0 05" },
+        { SIGNATURE_ENQUEUE_SOUND_FUNCTION, "enqueue_sound_function", SIGNATURE_GROUP_CLIENT, 0x0, "0F BF C1 56 8D 34 40 8B 04 F5 ?? ?? ?? ?? 85 C0" },
+        { SIGNATURE_GET_NEXT_SOUND_PERMUTATION_FUNCTION, "get_next_sound_permutation_function", SIGNATURE_GROUP_CLIENT, 0x0, "53 55 8B 6C 24 0C 8B 95 9C 00 00 00 0F BF C0 8D 04 C0" },
+        { SIGNATURE_GET_NEXT_SOUND_PERMUTATION_FUNCTION_PLAY_SOUND_CALL, "get_next_sound_permutation_function_play_sound_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 8B 55 08 33 C9 89 8D A8 00 00 00 89 8D A4 00 00 00" },
+        { SIGNATURE_MASTER_VOLUME, "master_volume", SIGNATURE_GROUP_CLIENT, 0x1, "BE ?? ?? ?? ?? 8D 7C 24 10 F3 A5 8B 42 34" },
+        { SIGNATURE_DRAW_8_BIT_TEXT, "draw_8_bit_text", SIGNATURE_GROUP_CLIENT, 0x0, "55 8B EC 83 E4 F8 81 EC A4 00 00 00 53 8B D8 A0 ?? ?? ?? ?? 84 C0 56 57 0F 84 DA 01 00 00" },
+        { SIGNATURE_DRAW_16_BIT_TEXT, "draw_16_bit_text", SIGNATURE_GROUP_CLIENT, 0x0, "55 8B EC 83 E4 F8 81 EC A4 00 00 00 53 8B D8 A0 ?? ?? ?? ?? 84 C0 56 57 8B F9 0F 84 D8 01 00 00" },
+        { SIGNATURE_TEXT_HOOK, "text_hook", SIGNATURE_GROUP_CLIENT, 0x0, "83 EC 48 A0 ?? ?? ?? ?? 53 33 DB 3C 01" },
+        { SIGNATURE_TEXT_FONT_DATA, "text_font_data", SIGNATURE_GROUP_CLIENT, 13, "C7 44 24 0C EB EA EA 3E 8B 4C 24 0C A3 ?? ?? ?? ?? 8B C2" },
+        { SIGNATURE_PLAY_BIK_VIDEO_FUNCTION, "play_bik_video_function", SIGNATURE_GROUP_CLIENT, 0x0, "83 EC 68 A1 ?? ?? ?? ?? 53 33 DB 3B C3 89 5C 24 0C" },
+        { SIGNATURE_PLAY_BIK_VIDEO_RESOLUTION_SET, "play_bik_video_resolution_set", SIGNATURE_GROUP_CLIENT, 0x0, "FF 91 90 00 00 00 85 C0 0F 85 ?? ?? ?? ?? A1 ?? ?? ?? ?? 8B 08" },
+        { SIGNATURE_INPUT_CONTROL_KEYS, "input_control_keys", SIGNATURE_GROUP_CLIENT, 0x4, "66 8B 0C 75 ?? ?? ?? ?? E8 ?? ?? ?? ?? 88 86 ?? ?? ?? ?? 46 83 FE 03" },
+
+        /** Renderer */
+        { SIGNATURE_CAMERA_DATA_READ, "camera_data_read", SIGNATURE_GROUP_CLIENT, 0x0, "?? ?? ?? ?? ?? 8B 45 EC 8B 4D F0 40 81 C6" }, // byte 0 may be patched (E8)
+        { SIGNATURE_LOAD_BITMAP_FUNCTION, "load_bitmap_function", SIGNATURE_GROUP_CLIENT, 0x0, "83 EC 08 53 55 56 8B F0 8A 46 0E 33 DB" },
+        { SIGNATURE_RENDER_HUD_FUNCTION_CALL, "render_hud_function_call", SIGNATURE_GROUP_CLIENT, 0x5, "E8 ?? ?? ?? ?? E8 ?? ?? ?? ?? A1 24 CD 68 00 85 C0 5E" },
+        { SIGNATURE_RENDER_HUD_FUNCTION, "render_hud_function", SIGNATURE_GROUP_CLIENT, 0x0, "8B 0D 68 E4 75 00 66 83 F9 FF 53 57 74 15 66 83 F9 01 7D 0F 8B 15 18 59 81 00" },
+        { SIGNATURE_RENDER_USER_INTERFACE_FUNCTION_CALL, "render_user_interface_function_call", SIGNATURE_GROUP_CLIENT, 0xC, "E8 ?? ?? ?? ?? E8 ?? ?? ?? ?? 8B C5 E8 ?? ?? ?? ?? 66 83 3D 82 C5 75 00 FF" },
+        { SIGNATURE_RENDER_USER_INTERFACE_FUNCTION, "render_user_interface_function", SIGNATURE_GROUP_CLIENT, 0x0, "33 C9 83 EC 14 66 3D FF FF 0F 94 C1 53 33 DB 49 23 C8 66 89 0D F0 53 81 00" },
+        { SIGNATURE_RENDER_POST_CARNAGE_REPORT_CALL, "render_post_carnage_report_call", SIGNATURE_GROUP_CLIENT, 0x2, "74 07 E8 ?? ?? ?? ?? EB 19 E8 ?? ?? ?? ?? E8 ?? ?? ?? ?? E8 ?? ?? ?? ?? E8 ?? ?? ?? ?? E8 ?? ?? ?? ?? 66 39 35 ?? ?? ?? ??" },
+        { SIGNATURE_RENDER_POST_CARNAGE_REPORT_FUNCTION, "render_post_carnage_report_function", SIGNATURE_GROUP_CLIENT, 0x0, "A1 ?? ?? ?? ?? 83 EC 08 56 33 F6 3B C6 74 31 83 3D ?? ?? ?? ?? 01" },
+        { SIGNATURE_RENDER_WIDGET_BACKGROUND_FUNCTION_CALL, "render_widget_background_function_call", SIGNATURE_GROUP_CLIENT, 0x0, "?? ?? ?? ?? ?? 83 C4 04 5F 5D 5B 5E 81 C4 30 01 00 00 C3" }, // byte 0 may be patched (E8)
+        { SIGNATURE_RENDER_HUD_ELEMENT_BITMAP_FUNCTION_CALL, "render_hud_element_bitmap_function_call", SIGNATURE_GROUP_CLIENT, 0x0, "?? ?? ?? ?? ?? 83 C4 04 5F 5D 5B 81 C4 10 01 00 00 C3" }, // byte 0 may be patched (E8)
+        { SIGNATURE_RENDER_NAVPOINT_FUNCTION_CALL, "render_navpoint_function_call", SIGNATURE_GROUP_CLIENT, 0x0, "?? ?? ?? ?? ?? 83 C4 10 8B 54 24 ?? 42 83 ?? 20 81 ?? ?? ?? ?? ?? 89" }, // byte 0 may be patched (E8)
+        { SIGNATURE_DRAW_SHADER_TRANSPARENT_CHICAGO_FUNCTION_CALL, "draw_shader_transparent_chicago_function_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 83 C4 08 E9 6F 08 00 00 8B 45 0C 50" },
+        { SIGNATURE_RASTERIZER_GET_VERTEX_SHADER_PERMUTATION_INDEX_FUNCTION, "rasterizer_get_vertex_shader_permutation_index_function", SIGNATURE_GROUP_CLIENT, 0x0, "83 F9 FF 74 53 0F BF 41 24 48 83 F8 06 77 49" },
+        { SIGNATURE_RASTERIZER_VERTEX_SHADERS_TABLE_ADDRESS, "rasterizer_vertex_shaders_table_address", SIGNATURE_GROUP_CLIENT, 0x3, "8B 04 C5 ?? ?? ?? ?? 50 51 FF 92 ?? ?? ?? ?? A1 ?? ?? ?? ?? 8B 08" },
+        { SIGNATURE_RASTERIZER_VERTEX_SHADERS_PERMUTATIONS_TABLE_ADDRESS, "rasterizer_vertex_shaders_permutations_table_address", SIGNATURE_GROUP_CLIENT, 0x4, "0F BF 04 45 ?? ?? ?? ?? 8B 04 C5 ?? ?? ?? ?? 50 51 FF 92 ?? ?? ?? ??" },
+        { SIGNATURE_RASTERIZER_VERTEX_DECLARATIONS_TABLE_ADDRESS, "rasterizer_vertex_declarations_table_address", SIGNATURE_GROUP_CLIENT, 0x3, "8B 14 95 ?? ?? ?? ?? 52 50 FF 91 ?? ?? ?? ?? A1 ?? ?? ?? ?? 8B 08" },
+        { SIGNATURE_RASTERIZER_VERTICES_TYPES_TABLE_ADDRESS, "rasterizer_vertices_types_table_address", SIGNATURE_GROUP_CLIENT, 0x3, "66 8B B1 ?? ?? ?? ?? 66 8B 4A ?? ?? ?? ?? 24 14 8B 4D 58" },
+        { SIGNATURE_RASTERIZER_RENDER_TRANSPARENT_GEOMETRY_GROUP_FUNCTION, "rasterizer_render_transparent_geometry_group_function", SIGNATURE_GROUP_CLIENT, 0x0, "55 8B EC 83 E4 F8 81 EC 34 01 00 00 53 8B 5D 08 8B 83 A0 00 00 00" },
+        { SIGNATURE_RASTERIZER_RENDER_TRANSPARENT_GEOMETRY_GROUP_VERTICES_FUNCTION, "rasterizer_render_transparent_geometry_group_vertices_function", SIGNATURE_GROUP_CLIENT, 0x0, "57 8B 79 48 85 FF 74 28 8B 41 58 85 C0 74 0E 8B 49 50 51" },
+        { SIGNATURE_RASTERIZER_SET_FRAMEBUFFER_BLEND_FUNCTION_FUNCTION, "rasterizer_set_framebuffer_blend_function_function", SIGNATURE_GROUP_CLIENT, 0x0, "66 83 F9 05 74 0A 66 83 F9 06 74 04 32 C0 EB 02" },
+        { SIGNATURE_RASTERIZER_SET_BITMAP_DATA_TEXTURE_FUNCTION, "rasterizer_set_bitmap_data_texture_function", SIGNATURE_GROUP_CLIENT, 0x0, "53 55 66 ?? ?? ?? ?? 56 8B F0 A0 ?? ?? ?? ?? 32 DB 84 C0" },
+        { SIGNATURE_RASTERIZER_APPLY_SHADER_TEXTURE_ANIMATION_FUNCTION, "rasterizer_apply_shader_texture_animation_function", SIGNATURE_GROUP_CLIENT, 0x0, "D9 05 88 21 61 00 83 EC 14 D9 46 04 DA E9 DF E0 F6 C4 44 7A 08" },
+        { SIGNATURE_RASTERIZER_FRAME_PARAMETERS_ADDRESS, "rasterizer_frame_parameters_address", SIGNATURE_GROUP_CLIENT, 0x2, "DD 05 ?? ?? ?? ?? 51 8B 48 60 D9 1C 24 52 8B 50 5C" },
+        { SIGNATURE_RASTERIZER_PREPARE_SHADER_TRANSPARENT_CHICAGO_FUNCTION, "rasterizer_prepare_shader_transparent_chicago_function", SIGNATURE_GROUP_CLIENT, 0x0, "51 8B 4B 54 85 C9 B0 01 0F 8E 91 01 00 00 55 56" },
+        { SIGNATURE_DRAW_BITMAP_IN_RECT_FUNCION, "draw_bitmap_in_rect_funcion", SIGNATURE_GROUP_CLIENT, 0x0, "8B 54 24 04 81 EC 30 01 00 00 56 33 F6 3B D6 0F 84 C4 02 00 00" },
+
+        /** Game state */
+        { SIGNATURE_EFFECT_TABLE_ADDRESS, "effect_table_address", SIGNATURE_GROUP_CLIENT, 0x1, "A1 ?? ?? ?? ?? 8B 15 ?? ?? ?? ?? 53 8B 5C 24 24 81 E3 FF FF 00 00" },
+        { SIGNATURE_DECAL_TABLE_ADDRESS, "decal_table_address", SIGNATURE_GROUP_CLIENT, 0x1, "A1 ?? ?? ?? ?? 8A 48 24 83 EC 10 84 C9 74 48 89 04 24 57 35 72 65 74 69" },
+        { SIGNATURE_PARTICLE_TABLE_ADDRESS, "particle_table_address", SIGNATURE_GROUP_CLIENT, 0x2, "8B 2D ?? ?? ?? ?? 83 CA FF 8B FD E8 ?? ?? ?? ?? 8B F8 83 FF FF 0F 84 10 06 00 00" },
+        { SIGNATURE_GAME_PAUSED_FLAG_ADDRESS, "game_paused_flag_address", SIGNATURE_GROUP_CLIENT, 0x2, "8B 15 ?? ?? ?? ?? 8A 42 02 84 C0 75 22 8B 0D" },
+
+        /** Multiplayer */
+        { SIGNATURE_SERVER_CONNECT_FUNCTION_CALL, "server_connect_function_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 83 C4 14 84 C0 74 12 B8 01 00 00 00" },
+        { SIGNATURE_NETWORK_GAME_MULTIPLAYER_SOUND_CALL, "network_game_multiplayer_sound_call", SIGNATURE_GROUP_CLIENT, 0x0, "C6 44 24 04 00 8A 86" },
+        { SIGNATURE_NETWORK_GAME_MULTIPLAYER_HUD_MESSAGE_DISPATCH_CALL, "network_game_multiplayer_hud_message_dispatch_call", SIGNATURE_GROUP_CLIENT, 0x2, "52 50 E8 ?? ?? ?? ?? 83 C4 10 5F" },
+
+        /** User interface */
+        { SIGNATURE_WIDGET_INPUT_HANDLE_FUNCTION, "widget_input_handle_function", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 38 1D ?? ?? ?? ?? 0F 84 ?? ?? ?? ?? 38 1D ?? ?? ?? ?? 0F 85 ?? ?? ?? ??" },
+        { SIGNATURE_WIDGET_ACCEPT_EVENT_CHECK, "widget_accept_event_check", SIGNATURE_GROUP_CLIENT, 0x0, "0F B6 47 04 66 39 46 04 75 63 80 7F 05 01 EB 3D" },
+        { SIGNATURE_WIDGET_MOUSE_PRESSED_BUTTON_CHECK, "widget_mouse_pressed_button_check", SIGNATURE_GROUP_CLIENT, 0, "FF 24 85 ?? ?? ?? ?? 8A 47 04 84 C0 EB 10 80 7F 04 01 EB 0A 80 7F 04 02" },
+        { SIGNATURE_WIDGET_TAB_LIST_ITEMS_NEXT_VERTICAL_CALL, "widget_tab_list_items_next_vertical_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 83 C4 0C 85 F6 75 09 BE 01 00 00 00 89 74 24 14" },
+        { SIGNATURE_WIDGET_TAB_LIST_ITEMS_NEXT_HORIZONTAL_CALL, "widget_tab_list_items_next_horizontal_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? E9 ?? ?? ?? ?? 8D 4C 24 11 51 57 53 E8 ?? ?? ?? ?? E9 ?? ?? ?? ?? 66 3D 01 00" },
+        { SIGNATURE_WIDGET_TAB_LIST_ITEMS_PREVIOUS_VERTICAL_CALL, "widget_tab_list_items_previous_vertical_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? E9 ?? ?? ?? ?? 66 3D 01 00 75 83 0F BF 47 06 3D 00 80 FF FF" },
+        { SIGNATURE_WIDGET_TAB_LIST_ITEMS_PREVIOUS_HORIZONTAL_CALL, "widget_tab_list_items_previous_horizontal_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 83 C4 0C 85 F6 75 08 C7 44 24 14 01 00 00 00 C6 44 24 12 01" },
+        { SIGNATURE_WIDGET_TAB_CHILDREN_NEXT_VERTICAL_CALL, "widget_tab_children_next_vertical_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? EB 78 66 3D 01 00 75 12 0F BF 47 06 3D 00 80 FF FF" },
+        { SIGNATURE_WIDGET_TAB_CHILDREN_NEXT_HORIZONTAL_CALL, "widget_tab_children_next_horizontal_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? EB 28 66 3D 01 00 75 34 0F BF 47 04 3D 00 80 FF FF 74 10" },
+        { SIGNATURE_WIDGET_TAB_CHILDREN_PREVIOUS_CALL, "widget_tab_children_previous_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 85 F6 75 09 BE 01 00 00 00 89 74 24 14 C6 44 24 12 01" },
+        { SIGNATURE_WIDGET_SOUND_PLAY_FUNCTION, "widget_sound_play_function", SIGNATURE_GROUP_CLIENT, 0x0, "0F BF C0 48 83 F8 03 77 69 57 FF 24 85 ?? ?? ?? ?? 68 ?? ?? ?? ?? BF 21 64 6E 73" },
+        { SIGNATURE_WIDGET_MOUSE_FOCUS_UPDATE, "widget_mouse_focus_update", SIGNATURE_GROUP_CLIENT, 0x0, "8B 56 30 89 72 38 8B 76 30 8B 46 30 85 C0 74 3C" },
+        { SIGNATURE_WIDGET_MEMORY_POOL_ADDRESS, "widget_memory_pool_address", SIGNATURE_GROUP_CLIENT, 0x2, "8B 0D ?? ?? ?? ?? 83 C0 F0 81 E6 FF FF FF 7F E8 ?? ?? ?? ?? 8B 51 14" },
+        { SIGNATURE_WIDGET_INPUT_HANDLER_CALL, "widget_input_handler_call", SIGNATURE_GROUP_CLIENT, 0x0, "E8 ?? ?? ?? ?? 38 1D ?? ?? ?? ?? 0F 84 ?? ?? ?? ?? 38 1D ?? ?? ?? ??" },
+
+        /** Network */
+        { SIGNATURE_NETWORK_GAME_SERVER_DECODE_HUD_MESSAGE_CALL, "network_game_server_decode_hud_message_call", SIGNATURE_GROUP_DEDICATED_SERVER, 0x0, "E8 ?? ?? ?? ?? 84 C0 0F 84 ?? ?? ?? ?? 8B 84 24 ?? ?? ?? ?? 53" },
+    };
+
+    static_assert(sizeof(signature_definitions) / sizeof(signature_definitions[0]) == SIGNATURE_COUNT, "Every signature ID must have a definition");
+
+    static_assert([]() {
+        for(std::size_t i = 0; i < SIGNATURE_COUNT; i++) {
+            if(signature_definitions[i].id != i) {
+                return false;
+            }
+        }
+        return true;
+    }(), "Signature definitions must be sorted by ID");
+
+    /**
+     * Signature IDs sorted by name, for binary search lookups
+     */
+    static constexpr auto signatures_by_name = []() {
+        std::array<SignatureId, SIGNATURE_COUNT> ids = {};
+        for(std::size_t i = 0; i < SIGNATURE_COUNT; i++) {
+            ids[i] = static_cast<SignatureId>(i);
+        }
+        std::sort(ids.begin(), ids.end(), [](SignatureId a, SignatureId b) {
+            return std::string_view(signature_definitions[a].name) < std::string_view(signature_definitions[b].name);
+        });
+        return ids;
+    }();
+
+    static_assert([]() {
+        for(std::size_t i = 1; i < SIGNATURE_COUNT; i++) {
+            if(std::string_view(signature_definitions[signatures_by_name[i - 1]].name) == signature_definitions[signatures_by_name[i]].name) {
+                return false;
+            }
+        }
+        return true;
+    }(), "Signature names must be unique");
+
+    const SignatureDefinition &get_signature_definition(SignatureId id) noexcept {
+        return signature_definitions[id];
+    }
+
+    std::optional<SignatureId> find_signature_id(std::string_view name) noexcept {
+        auto it = std::lower_bound(signatures_by_name.begin(), signatures_by_name.end(), name, [](SignatureId id, std::string_view name) {
+            return signature_definitions[id].name < name;
+        });
+        if(it != signatures_by_name.end() && signature_definitions[*it].name == name) {
+            return *it;
+        }
+        return std::nullopt;
+    }
+}
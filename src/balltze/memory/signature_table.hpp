@@ -0,0 +1,335 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__MEMORY__SIGNATURE_TABLE_HPP
+#define BALLTZE__MEMORY__SIGNATURE_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#define MAX_SIGNATURE_SIZE 64
+
+namespace Balltze::Memory {
+    enum SignatureGroup {
+        SIGNATURE_GROUP_CORE,
+        SIGNATURE_GROUP_CLIENT,
+        SIGNATURE_GROUP_DEDICATED_SERVER
+    };
+
+    /**
+     * Signatures of the game executable; a signature ID is its index in the signature table.
+     */
+    enum SignatureId : std::size_t {
+        /** Core */
+        SIGNATURE_CONSOLE_OUT,
+        SIGNATURE_ENGINE_TYPE,
+        SIGNATURE_HALO_PATH,
+        SIGNATURE_RESOLUTION,
+        SIGNATURE_TICK_COUNTER,
+        SIGNATURE_TICK_RATE,
+        SIGNATURE_SERVER_TYPE,
+        SIGNATURE_CURRENT_GAMETYPE,
+        SIGNATURE_MAP_INDEX,
+        SIGNATURE_GET_TAG_HANDLE,
+        SIGNATURE_ON_TICK,
+        SIGNATURE_ON_FRAME,
+
+        /** Map loading */
+        SIGNATURE_ON_MAP_LOAD,
+        SIGNATURE_MAP_HEADER,
+        SIGNATURE_MAP_LOAD_PATH,
+        SIGNATURE_READ_MAP_FILE_DATA,
+        SIGNATURE_READ_MAP_FILE_DATA_CALL_1,
+        SIGNATURE_READ_MAP_FILE_DATA_CALL_2,
+        SIGNATURE_LOAD_MAP_FUNCTION,
+
+        /** Input */
+        SIGNATURE_KEYPRESS_EVENT,
+        SIGNATURE_KEYBOARD_INPUT,
+        SIGNATURE_MOUSE_INPUT,
+        SIGNATURE_GAMEPAD_INPUT,
+        SIGNATURE_GET_BUTTON_NAME_FUNCTION,
+        SIGNATURE_CONTROLS_STRUCT_ADDRESS,
+        SIGNATURE_KEYBOARD_KEYS_STRUCT_ADDRESS,
+
+        /** User interface */
+        SIGNATURE_SINGLEPLAYER_PAUSE_MENU_TAG_PATH,
+        SIGNATURE_MULTIPLAYER_PAUSE_MENU_TAG_PATH,
+        SIGNATURE_WIDGET_GLOBALS,
+        SIGNATURE_WIDGET_EVENT_GLOBALS,
+        SIGNATURE_WIDGET_CURSOR_GLOBALS,
+        SIGNATURE_WIDGET_CREATE_FUNCTION,
+        SIGNATURE_WIDGET_OPEN_FUNCTION,
+        SIGNATURE_WIDGET_BACK_FUNCTION,
+        SIGNATURE_WIDGET_FIND_FUNCTION,
+        SIGNATURE_WIDGET_FOCUS_FUNCTION,
+        SIGNATURE_WIDGET_LIST_ITEM_INDEX_FUNCTION,
+        SIGNATURE_WIDGET_MEMORY_RELEASE_FUNCTION,
+
+        /** Game state */
+        SIGNATURE_CAMERA_COORD,
+        SIGNATURE_CAMERA_TYPE,
+        SIGNATURE_ANTENNA_TABLE_ADDRESS,
+        SIGNATURE_OBJECT_TABLE_ADDRESS,
+        SIGNATURE_DELETE_OBJECT_FUNCTION,
+        SIGNATURE_CREATE_OBJECT_FUNCTION,
+        SIGNATURE_CREATE_OBJECT_QUERY_FUNCTION,
+        SIGNATURE_APPLY_DAMAGE_FUNCTION,
+        SIGNATURE_FLAG_TABLE_ADDRESS,
+        SIGNATURE_LIGHT_TABLE_ADDRESS,
+        SIGNATURE_PLAYER_HANDLE_ADDRESS,
+        SIGNATURE_PLAYER_TABLE_ADDRESS,
+        SIGNATURE_UNIT_ENTER_VEHICLE_FUNCTION,
+        SIGNATURE_UNIT_EXIT_VEHICLE_FUNCTION,
+        SIGNATURE_GET_NUMERIC_COUNTDOWN_TIMER_FUNCTION,
+        SIGNATURE_EXECUTE_SCRIPT_FUNCTION,
+
+        /** Commands */
+        SIGNATURE_EXECUTE_CONSOLE_COMMAND_SAPP_LOADER_HOOK,
+        SIGNATURE_CONSOLE_UNKNOWN_COMMAND_MESSAGE_PRINT_CALL,
+        SIGNATURE_CONSOLE_TAB_COMPLETION_FUNCTION_CALL,
+        SIGNATURE_COMMAND_LIST_ADDRESS_CUSTOM_EDITION,
+        SIGNATURE_HELP_COMMAND_FUNCTION_COMMAND_LIST_ADDRESS_1,
+        SIGNATURE_HELP_COMMAND_FUNCTION_COMMAND_LIST_ADDRESS_2,
+        SIGNATURE_FIND_CONSOLE_COMMAND_ENTRY_FUNCTION_COMMAND_LIST_ADDRESS,
+        SIGNATURE_FIND_CONSOLE_COMMAND_ENTRY_FUNCTION_COMMAND_LIST_COUNT,
+
+        /** Multiplayer */
+        SIGNATURE_NETWORK_GAME_CLIENT_SEND_CHAT_MESSAGE_FUNCTION,
+        SIGNATURE_SERVER_INFO_PLAYER_LIST_OFFSET,
+        SIGNATURE_SERVER_INFO_HOST,
+        SIGNATURE_SERVER_INFO_CLIENT,
+
+        /** Extended limits */
+        SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_RESERVE_LOCAL_VARS_SPACE,
+        SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_FREE_LOCAL_VARS_SPACE,
+        SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_PARAM_1_READ_1,
+        SIGNATURE_READ_REGION_PERMUTATION_FUNCTION_PARAM_1_READ_2,
+
+        /** Network */
+        SIGNATURE_NETWORK_GAME_ENCODE_MESSAGE_FUNCTION,
+        SIGNATURE_NETWORK_GAME_DECODE_MESSAGE_FUNCTION,
+        SIGNATURE_NETWORK_GAME_SERVER_SEND_MESSAGE_TO_ALL_MACHINES_FUNCTION,
+        SIGNATURE_NETWORK_GAME_SERVER_SEND_MESSAGE_TO_MACHINE_FUNCTION,
+        SIGNATURE_NETWORK_GAME_DATA_POINTER,
+        SIGNATURE_NETWORK_GAME_CLIENT_SEND_MESSAGE_FUNCTION,
+        SIGNATURE_NETWORK_GAME_CLIENT_UNKNOWN_FUNCTION_1,
+        SIGNATURE_NETWORK_GAME_CLIENT_PROCESS_RECEIVED_MESSAGE_FUNCTION,
+        SIGNATURE_NETWORK_GAME_CLIENT_DECODE_HUD_MESSAGE_CALL,
+
+        /** Client core */
+        SIGNATURE_WINDOW_GLOBALS,
+        SIGNATURE_RCON_MESSAGE_FUNCTION_CALL,
+
+        /** Direct3D */
+        SIGNATURE_D3D9_CALL_END_SCENE,
+        SIGNATURE_D3D9_CALL_RESET,
+        SIGNATURE_D3D9_CALL_BEGIN_SCENE,
+        SIGNATURE_D3D9_RENDER_TARGETS,
+        SIGNATURE_D3D9_DEVICE_BEHAVIOR_FLAGS,
+        SIGNATURE_D3D9_DEVICE_POINTER,
+
+        /** Map loading */
+        SIGNATURE_MODEL_DATA_BUFFER_ALLOC,
+        SIGNATURE_TAG_DATA_READ_DONE,
+        SIGNATURE_LOAD_MAP_FUNCTION_MULTIPLAYER_CALL,
+        SIGNATURE_LOAD_MAP_FUNCTION_SINGLEPLAYER_CALL,
+
+        /** HUD button icons */
+        SIGNATURE_HOLD_FOR_WEAPON_HUD_BUTTON_NAME_DRAW,
+        SIGNATURE_HUD_ICON_MESSAGES_TAG_HANDLE,
+        SIGNATURE_DRAW_HUD_BITMAP_FUNCTION,
+        SIGNATURE_HOLD_FOR_ACTION_MESSAGE_LEFT_QUOTE_PRINT,
+        SIGNATURE_HOLD_FOR_ACTION_MESSAGE_RIGHT_QUOTE_PRINT,
+
+        /** User interface */
+        SIGNATURE_PLAY_SOUND_FUNCTION,
+        SIGNATURE_ENQUEUE_SOUND_FUNCTION,
+        SIGNATURE_GET_NEXT_SOUND_PERMUTATION_FUNCTION,
+        SIGNATURE_GET_NEXT_SOUND_PERMUTATION_FUNCTION_PLAY_SOUND_CALL,
+        SIGNATURE_MASTER_VOLUME,
+        SIGNATURE_DRAW_8_BIT_TEXT,
+        SIGNATURE_DRAW_16_BIT_TEXT,
+        SIGNATURE_TEXT_HOOK,
+        SIGNATURE_TEXT_FONT_DATA,
+        SIGNATURE_PLAY_BIK_VIDEO_FUNCTION,
+        SIGNATURE_PLAY_BIK_VIDEO_RESOLUTION_SET,
+        SIGNATURE_INPUT_CONTROL_KEYS,
+
+        /** Renderer */
+        SIGNATURE_CAMERA_DATA_READ,
+        SIGNATURE_LOAD_BITMAP_FUNCTION,
+        SIGNATURE_RENDER_HUD_FUNCTION_CALL,
+        SIGNATURE_RENDER_HUD_FUNCTION,
+        SIGNATURE_RENDER_USER_INTERFACE_FUNCTION_CALL,
+        SIGNATURE_RENDER_USER_INTERFACE_FUNCTION,
+        SIGNATURE_RENDER_POST_CARNAGE_REPORT_CALL,
+        SIGNATURE_RENDER_POST_CARNAGE_REPORT_FUNCTION,
+        SIGNATURE_RENDER_WIDGET_BACKGROUND_FUNCTION_CALL,
+        SIGNATURE_RENDER_HUD_ELEMENT_BITMAP_FUNCTION_CALL,
+        SIGNATURE_RENDER_NAVPOINT_FUNCTION_CALL,
+        SIGNATURE_DRAW_SHADER_TRANSPARENT_CHICAGO_FUNCTION_CALL,
+        SIGNATURE_RASTERIZER_GET_VERTEX_SHADER_PERMUTATION_INDEX_FUNCTION,
+        SIGNATURE_RASTERIZER_VERTEX_SHADERS_TABLE_ADDRESS,
+        SIGNATURE_RASTERIZER_VERTEX_SHADERS_PERMUTATIONS_TABLE_ADDRESS,
+        SIGNATURE_RASTERIZER_VERTEX_DECLARATIONS_TABLE_ADDRESS,
+        SIGNATURE_RASTERIZER_VERTICES_TYPES_TABLE_ADDRESS,
+        SIGNATURE_RASTERIZER_RENDER_TRANSPARENT_GEOMETRY_GROUP_FUNCTION,
+        SIGNATURE_RASTERIZER_RENDER_TRANSPARENT_GEOMETRY_GROUP_VERTICES_FUNCTION,
+        SIGNATURE_RASTERIZER_SET_FRAMEBUFFER_BLEND_FUNCTION_FUNCTION,
+        SIGNATURE_RASTERIZER_SET_BITMAP_DATA_TEXTURE_FUNCTION,
+        SIGNATURE_RASTERIZER_APPLY_SHADER_TEXTURE_ANIMATION_FUNCTION,
+        SIGNATURE_RASTERIZER_FRAME_PARAMETERS_ADDRESS,
+        SIGNATURE_RASTERIZER_PREPARE_SHADER_TRANSPARENT_CHICAGO_FUNCTION,
+        SIGNATURE_DRAW_BITMAP_IN_RECT_FUNCION,
+
+        /** Game state */
+        SIGNATURE_EFFECT_TABLE_ADDRESS,
+        SIGNATURE_DECAL_TABLE_ADDRESS,
+        SIGNATURE_PARTICLE_TABLE_ADDRESS,
+        SIGNATURE_GAME_PAUSED_FLAG_ADDRESS,
+
+        /** Multiplayer */
+        SIGNATURE_SERVER_CONNECT_FUNCTION_CALL,
+        SIGNATURE_NETWORK_GAME_MULTIPLAYER_SOUND_CALL,
+        SIGNATURE_NETWORK_GAME_MULTIPLAYER_HUD_MESSAGE_DISPATCH_CALL,
+
+        /** User interface */
+        SIGNATURE_WIDGET_INPUT_HANDLE_FUNCTION,
+        SIGNATURE_WIDGET_ACCEPT_EVENT_CHECK,
+        SIGNATURE_WIDGET_MOUSE_PRESSED_BUTTON_CHECK,
+        SIGNATURE_WIDGET_TAB_LIST_ITEMS_NEXT_VERTICAL_CALL,
+        SIGNATURE_WIDGET_TAB_LIST_ITEMS_NEXT_HORIZONTAL_CALL,
+        SIGNATURE_WIDGET_TAB_LIST_ITEMS_PREVIOUS_VERTICAL_CALL,
+        SIGNATURE_WIDGET_TAB_LIST_ITEMS_PREVIOUS_HORIZONTAL_CALL,
+        SIGNATURE_WIDGET_TAB_CHILDREN_NEXT_VERTICAL_CALL,
+        SIGNATURE_WIDGET_TAB_CHILDREN_NEXT_HORIZONTAL_CALL,
+        SIGNATURE_WIDGET_TAB_CHILDREN_PREVIOUS_CALL,
+        SIGNATURE_WIDGET_SOUND_PLAY_FUNCTION,
+        SIGNATURE_WIDGET_MOUSE_FOCUS_UPDATE,
+        SIGNATURE_WIDGET_MEMORY_POOL_ADDRESS,
+        SIGNATURE_WIDGET_INPUT_HANDLER_CALL,
+
+        /** Network */
+        SIGNATURE_NETWORK_GAME_SERVER_DECODE_HUD_MESSAGE_CALL,
+
+        SIGNATURE_COUNT
+    };
+
+    /**
+     * Get the value of a hexadecimal digit
+     * @param digit     Digit character
+     * @return          Value of the digit, or -1 if it is not a hexadecimal digit
+     */
+    constexpr int hex_digit_value(char digit) noexcept {
+        if(digit >= '0' && digit <= '9') {
+            return digit - '0';
+        }
+        if(digit >= 'A' && digit <= 'F') {
+            return digit - 'A' + 10;
+        }
+        if(digit >= 'a' && digit <= 'f') {
+            return digit - 'a' + 10;
+        }
+        return -1;
+    }
+
+    /**
+     * Parse a signature pattern string like "83 EC ?? 57"; spaces between bytes are optional.
+     * @param pattern   Pattern string
+     * @param callback  Function called with every byte of the pattern; wildcards are -1
+     * @return          False if the pattern has invalid bytes
+     */
+    template<typename T>
+    constexpr bool parse_signature_pattern(std::string_view pattern, T &&callback) {
+        std::size_t i = 0;
+        while(i < pattern.size()) {
+            if(pattern[i] == ' ') {
+                i++;
+                continue;
+            }
+            if(i + 1 >= pattern.size()) {
+                return false;
+            }
+            if(pattern[i] == '?' && pattern[i + 1] == '?') {
+                callback(static_cast<short>(-1));
+            }
+            else {
+                auto high = hex_digit_value(pattern[i]);
+                auto low = hex_digit_value(pattern[i + 1]);
+                if(high == -1 || low == -1) {
+                    return false;
+                }
+                callback(static_cast<short>(high << 4 | low));
+            }
+            i += 2;
+        }
+        return true;
+    }
+
+    /**
+     * Signature pattern parsed at compile time, stored as value/mask pairs.
+     */
+    struct SignaturePattern {
+        /** Bytes to match; wildcard positions are zero */
+        std::array<std::uint8_t, MAX_SIGNATURE_SIZE> values = {};
+
+        /** Match mask; 0xFF for bytes that must match and 0x00 for wildcards */
+        std::array<std::uint8_t, MAX_SIGNATURE_SIZE> mask = {};
+
+        /** Number of bytes */
+        std::size_t size = 0;
+
+        /**
+         * Parse a pattern string; invalid patterns do not compile.
+         * @param pattern   Pattern string like "83 EC ?? 57"
+         */
+        consteval SignaturePattern(const char *pattern) {
+            bool valid = parse_signature_pattern(pattern, [this](short byte) {
+                if(size == MAX_SIGNATURE_SIZE) {
+                    throw "Signature pattern is too long";
+                }
+                values[size] = byte == -1 ? 0x00 : static_cast<std::uint8_t>(byte);
+                mask[size] = byte == -1 ? 0x00 : 0xFF;
+                size++;
+            });
+            if(!valid || size == 0) {
+                throw "Invalid signature pattern";
+            }
+        }
+    };
+
+    struct SignatureDefinition {
+        /** Signature ID */
+        SignatureId id;
+
+        /** Signature name, as used by get_signature */
+        const char *name;
+
+        /** Which executables have this signature */
+        SignatureGroup group;
+
+        /** Offset of the signature address from the start of the pattern */
+        std::uint16_t offset;
+
+        /** Pattern to find */
+        SignaturePattern pattern;
+    };
+
+    /**
+     * Get the definition of a signature
+     * @param id    Signature ID; must be lower than SIGNATURE_COUNT
+     */
+    const SignatureDefinition &get_signature_definition(SignatureId id) noexcept;
+
+    /**
+     * Look up a signature ID by name
+     * @param name  Signature name
+     * @return      Signature ID, or nothing if there is no signature with that name
+     */
+    std::optional<SignatureId> find_signature_id(std::string_view name) noexcept;
+}
+
+#endif
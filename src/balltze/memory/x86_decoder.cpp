@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include "x86_decoder.hpp"
+
+namespace Balltze::Memory {
+    enum : std::uint16_t {
+        NO = 0,         // no operands to decode
+        MR = 1 << 0,    // ModRM byte
+        I8 = 1 << 1,    // 8-bit immediate
+        I16 = 1 << 2,   // 16-bit immediate
+        IZ = 1 << 3,    // 16 or 32-bit immediate, depending on the operand size
+        R8 = 1 << 4,    // 8-bit relative branch
+        RZ = 1 << 5,    // 16 or 32-bit relative branch, depending on the operand size
+        MO = 1 << 6,    // 16 or 32-bit memory offset, depending on the address size
+        PF = 1 << 7,    // prefix
+        XX = 1 << 8,    // invalid in 32-bit mode
+        G3 = 1 << 9     // group 3; TEST has an immediate, the other instructions don't
+    };
+
+    static constexpr std::uint16_t one_byte_opcodes[256] = {
+        /*        0        1        2        3        4        5        6        7        8        9        A        B        C        D        E        F */
+        /* 0 */   MR,      MR,      MR,      MR,      I8,      IZ,      NO,      NO,      MR,      MR,      MR,      MR,      I8,      IZ,      NO,      NO,
+        /* 1 */   MR,      MR,      MR,      MR,      I8,      IZ,      NO,      NO,      MR,      MR,      MR,      MR,      I8,      IZ,      NO,      NO,
+        /* 2 */   MR,      MR,      MR,      MR,      I8,      IZ,      PF,      NO,      MR,      MR,      MR,      MR,      I8,      IZ,      PF,      NO,
+        /* 3 */   MR,      MR,      MR,      MR,      I8,      IZ,      PF,      NO,      MR,      MR,      MR,      MR,      I8,      IZ,      PF,      NO,
+        /* 4 */   NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,
+        /* 5 */   NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,
+        /* 6 */   NO,      NO,      MR,      MR,      PF,      PF,      PF,      PF,      IZ,      MR | IZ, I8,      MR | I8, NO,      NO,      NO,      NO,
+        /* 7 */   R8,      R8,      R8,      R8,      R8,      R8,      R8,      R8,      R8,      R8,      R8,      R8,      R8,      R8,      R8,      R8,
+        /* 8 */   MR | I8, MR | IZ, MR | I8, MR | I8, MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,
+        /* 9 */   NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      IZ | I16,NO,      NO,      NO,      NO,      NO,
+        /* A */   MO,      MO,      MO,      MO,      NO,      NO,      NO,      NO,      I8,      IZ,      NO,      NO,      NO,      NO,      NO,      NO,
+        /* B */   I8,      I8,      I8,      I8,      I8,      I8,      I8,      I8,      IZ,      IZ,      IZ,      IZ,      IZ,      IZ,      IZ,      IZ,
+        /* C */   MR | I8, MR | I8, I16,     NO,      MR,      MR,      MR | I8, MR | IZ, I16 | I8,NO,      I16,     NO,      NO,      I8,      NO,      NO,
+        /* D */   MR,      MR,      MR,      MR,      I8,      I8,      NO,      NO,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,
+        /* E */   R8,      R8,      R8,      R8,      I8,      I8,      I8,      I8,      RZ,      RZ,      IZ | I16,R8,      NO,      NO,      NO,      NO,
+        /* F */   PF,      NO,      PF,      PF,      NO,      NO,      MR | G3, MR | G3, NO,      NO,      NO,      NO,      NO,      NO,      MR,      MR
+    };
+
+    static constexpr std::uint16_t two_byte_opcodes[256] = {
+        /*        0        1        2        3        4        5        6        7        8        9        A        B        C        D        E        F */
+        /* 0 */   MR,      MR,      MR,      MR,      XX,      NO,      NO,      NO,      NO,      NO,      XX,      NO,      XX,      MR,      NO,      MR | I8,
+        /* 1 */   MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,
+        /* 2 */   MR,      MR,      MR,      MR,      XX,      XX,      XX,      XX,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,
+        /* 3 */   NO,      NO,      NO,      NO,      NO,      NO,      XX,      NO,      XX,      XX,      XX,      XX,      XX,      XX,      XX,      XX,
+        /* 4 */   MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,
+        /* 5 */   MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,
+        /* 6 */   MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,
+        /* 7 */   MR | I8, MR | I8, MR | I8, MR | I8, MR,      MR,      MR,      NO,      MR,      MR,      XX,      XX,      MR,      MR,      MR,      MR,
+        /* 8 */   RZ,      RZ,      RZ,      RZ,      RZ,      RZ,      RZ,      RZ,      RZ,      RZ,      RZ,      RZ,      RZ,      RZ,      RZ,      RZ,
+        /* 9 */   MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,
+        /* A */   NO,      NO,      NO,      MR,      MR | I8, MR,      XX,      XX,      NO,      NO,      NO,      MR,      MR | I8, MR,      MR,      MR,
+        /* B */   MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR | I8, MR,      MR,      MR,      MR,      MR,
+        /* C */   MR,      MR,      MR | I8, MR,      MR | I8, MR | I8, MR | I8, MR,      NO,      NO,      NO,      NO,      NO,      NO,      NO,      NO,
+        /* D */   MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,
+        /* E */   MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,
+        /* F */   MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR,      MR
+    };
+
+    /**
+     * Get the size of the ModRM byte and everything it implies (SIB byte and displacement).
+     */
+    static bool decode_modrm(const std::uint8_t *code, std::size_t available, bool address_size_16, std::size_t &size) noexcept {
+        if(available < 1) {
+            return false;
+        }
+
+        auto modrm = code[0];
+        auto mod = modrm >> 6;
+        auto rm = modrm & 0x7;
+        size = 1;
+
+        if(mod == 3) {
+            return true;
+        }
+
+        if(address_size_16) {
+            if(mod == 1) {
+                size += 1;
+            }
+            else if(mod == 2 || (mod == 0 && rm == 6)) {
+                size += 2;
+            }
+            return size <= available;
+        }
+
+        if(rm == 4) {
+            if(available < 2) {
+                return false;
+            }
+            auto base = code[1] & 0x7;
+            size += 1;
+            if(mod == 0 && base == 5) {
+                size += 4;
+            }
+        }
+        else if(mod == 0 && rm == 5) {
+            size += 4;
+        }
+
+        if(mod == 1) {
+            size += 1;
+        }
+        else if(mod == 2) {
+            size += 4;
+        }
+        return size <= available;
+    }
+
+    bool decode_x86_instruction(const std::uint8_t *code, std::size_t available, X86Instruction &instruction) noexcept {
+        if(available > X86_MAX_INSTRUCTION_LENGTH) {
+            available = X86_MAX_INSTRUCTION_LENGTH;
+        }
+
+        instruction = {};
+        bool operand_size_16 = false;
+        bool address_size_16 = false;
+        std::size_t position = 0;
+
+        // Prefixes
+        while(position < available && (one_byte_opcodes[code[position]] & PF)) {
+            if(code[position] == 0x66) {
+                operand_size_16 = true;
+            }
+            else if(code[position] == 0x67) {
+                address_size_16 = true;
+            }
+            position++;
+        }
+        instruction.prefix_count = position;
+
+        // Opcode
+        if(position >= available) {
+            return false;
+        }
+        auto opcode = code[position++];
+        auto flags = one_byte_opcodes[opcode];
+        if(opcode == 0x0F) {
+            if(position >= available) {
+                return false;
+            }
+            opcode = code[position++];
+            instruction.extended_opcode = true;
+
+            if(opcode == 0x38 || opcode == 0x3A) {
+                // Three byte opcodes; all of them have a ModRM byte and the 0F 3A ones have an immediate too
+                if(position >= available) {
+                    return false;
+                }
+                flags = opcode == 0x3A ? (MR | I8) : MR;
+                opcode = code[position++];
+            }
+            else {
+                flags = two_byte_opcodes[opcode];
+            }
+        }
+        instruction.opcode = opcode;
+
+        if(flags & XX) {
+            return false;
+        }
+
+        // Operands
+        if(flags & MR) {
+            std::size_t modrm_size;
+            if(!decode_modrm(code + position, available - position, address_size_16, modrm_size)) {
+                return false;
+            }
+
+            // TEST r/m, imm is the only group 3 instruction with an immediate
+            if((flags & G3) && ((code[position] >> 3) & 0x7) < 2) {
+                flags |= opcode == 0xF6 ? I8 : IZ;
+            }
+            position += modrm_size;
+        }
+
+        std::size_t immediate_size = 0;
+        if(flags & I8) {
+            immediate_size += 1;
+        }
+        if(flags & I16) {
+            immediate_size += 2;
+        }
+        if(flags & IZ) {
+            immediate_size += operand_size_16 ? 2 : 4;
+        }
+        if(flags & MO) {
+            immediate_size += address_size_16 ? 2 : 4;
+        }
+        if(flags & (R8 | RZ)) {
+            instruction.relative_offset = position;
+            instruction.relative_size = (flags & R8) ? 1 : (operand_size_16 ? 2 : 4);
+            immediate_size += instruction.relative_size;
+        }
+
+        position += immediate_size;
+        if(position > available) {
+            return false;
+        }
+        instruction.length = position;
+        return true;
+    }
+}
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__MEMORY__X86_DECODER_HPP
+#define BALLTZE__MEMORY__X86_DECODER_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+#define X86_MAX_INSTRUCTION_LENGTH 15
+
+namespace Balltze::Memory {
+    /**
+     * Length and layout of a decoded IA-32 instruction.
+     */
+    struct X86Instruction {
+        /** Size of the whole instruction, prefixes included */
+        std::size_t length;
+
+        /** Number of prefix bytes */
+        std::size_t prefix_count;
+
+        /** Last opcode byte */
+        std::uint8_t opcode;
+
+        /** Is this a 0F-prefixed (two or three byte) opcode? */
+        bool extended_opcode;
+
+        /** Offset of the relative branch displacement from the start of the instruction */
+        std::size_t relative_offset;
+
+        /** Size of the relative branch displacement; zero if the instruction is not a relative branch */
+        std::size_t relative_size;
+    };
+
+    /**
+     * Decode the length of a 32-bit mode x86 instruction.
+     * @param code          Instruction bytes
+     * @param available     Number of bytes that can be read from code
+     * @param instruction   Decoded instruction
+     * @return              False if the instruction is invalid or truncated
+     */
+    bool decode_x86_instruction(const std::uint8_t *code, std::size_t available, X86Instruction &instruction) noexcept;
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include <fstream>
 #include <balltze/hook.hpp>
 #include <balltze/memory.hpp>
+#include "../memory/memory.hpp"
 
 namespace Balltze {
     extern "C" {
@@ -34,7 +35,7 @@ namespace Balltze {
     }
 
     void play_bik_video(std::filesystem::path const &path) {
-        auto *play_bik_video_sig = Memory::get_signature("play_bik_video_function"); 
+        auto *play_bik_video_sig = Memory::get_signature(Memory::SIGNATURE_PLAY_BIK_VIDEO_FUNCTION); 
         auto *play_bik_video = reinterpret_cast<void (*)(const char *)>(play_bik_video_sig->data());
         std::uint32_t width = 0;
         std::uint32_t height = 0;
@@ -48,7 +49,7 @@ namespace Balltze {
         bik_video_width = width;
         bik_video_height = height;
         if(!play_bik_video_res_override_hook) {
-            auto *play_bik_video_resolution_set_sig = Memory::get_signature("play_bik_video_resolution_set");
+            auto *play_bik_video_resolution_set_sig = Memory::get_signature(Memory::SIGNATURE_PLAY_BIK_VIDEO_RESOLUTION_SET);
             play_bik_video_res_override_hook = Memory::hook_function(play_bik_video_resolution_set_sig->data(), play_bik_video_hook, std::nullopt, false);
         }
         play_bik_video(path.string().c_str());
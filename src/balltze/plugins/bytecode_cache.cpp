@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <fmt/format.h>
+#include "../logger.hpp"
+#include "bytecode_cache.hpp"
+
+#define BYTECODE_CACHE_DIRECTORY ".cache"
+#define BYTECODE_CACHE_MAGIC "BLTZLUAC"
+
+namespace fs = std::filesystem;
+
+namespace Balltze::Plugins {
+    /**
+     * Header of a cache entry; followed by the relative path of the source file and then the chunk
+     */
+    struct BytecodeCacheHeader {
+        char magic[8];
+        std::int64_t source_time;
+        std::uint64_t source_size;
+        std::uint32_t path_length;
+    };
+
+    static std::uint64_t fnv1a_hash(const std::string &data) noexcept {
+        std::uint64_t hash = 0xCBF29CE484222325;
+        for(unsigned char c : data) {
+            hash ^= c;
+            hash *= 0x100000001B3;
+        }
+        return hash;
+    }
+
+    static int write_chunk(lua_State *state, const void *data, std::size_t size, void *buffer) noexcept {
+        try {
+            auto *bytes = static_cast<const char *>(data);
+            static_cast<std::vector<char> *>(buffer)->insert(static_cast<std::vector<char> *>(buffer)->end(), bytes, bytes + size);
+            return 0;
+        }
+        catch(std::bad_alloc &) {
+            return 1;
+        }
+    }
+
+    static bool load_cache_entry(lua_State *state, const fs::path &cache_file, const BytecodeCacheHeader &expected_header, const std::string &relative_path, const std::string &chunk_name) {
+        std::ifstream input(cache_file, std::ios::binary);
+        if(!input) {
+            return false;
+        }
+        std::vector<char> data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+        std::size_t chunk_offset = sizeof(BytecodeCacheHeader) + relative_path.size();
+        if(data.size() <= chunk_offset) {
+            return false;
+        }
+
+        BytecodeCacheHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+        if(std::memcmp(header.magic, expected_header.magic, sizeof(header.magic)) != 0 || header.source_time != expected_header.source_time || header.source_size != expected_header.source_size || header.path_length != expected_header.path_length || std::memcmp(data.data() + sizeof(header), relative_path.data(), relative_path.size()) != 0) {
+            return false;
+        }
+
+        if(luaL_loadbufferx(state, data.data() + chunk_offset, data.size() - chunk_offset, chunk_name.c_str(), "b") != LUA_OK) {
+            logger.debug("Discarding bytecode cache of {}: {}", relative_path, lua_tostring(state, -1));
+            lua_pop(state, 1);
+            return false;
+        }
+        return true;
+    }
+
+    static void save_cache_entry(lua_State *state, const fs::path &cache_file, const BytecodeCacheHeader &header, const std::string &relative_path) {
+        std::vector<char> data(sizeof(header));
+        std::memcpy(data.data(), &header, sizeof(header));
+        data.insert(data.end(), relative_path.begin(), relative_path.end());
+        if(lua_dump(state, write_chunk, &data, 0) != 0) {
+            throw std::runtime_error("could not dump chunk");
+        }
+
+        // Write to a temporary file first, so a failed write never leaves a truncated entry behind
+        fs::create_directories(cache_file.parent_path());
+        auto temporary_file = cache_file;
+        temporary_file += ".tmp";
+        {
+            std::ofstream output(temporary_file, std::ios::binary | std::ios::trunc);
+            output.write(data.data(), data.size());
+            if(!output) {
+                throw std::runtime_error("could not write " + temporary_file.string());
+            }
+        }
+        fs::rename(temporary_file, cache_file);
+    }
+
+    int load_cached_lua_file(lua_State *state, const fs::path &plugin_directory, const fs::path &file) noexcept {
+        auto file_name = file.string();
+        auto chunk_name = "@" + file_name;
+        try {
+            auto relative_path = fs::relative(file, plugin_directory).generic_string();
+            if(relative_path.empty() || relative_path.starts_with("..")) {
+                return luaL_loadfile(state, file_name.c_str());
+            }
+
+            BytecodeCacheHeader header = {};
+            std::memcpy(header.magic, BYTECODE_CACHE_MAGIC, sizeof(header.magic));
+            header.source_time = fs::last_write_time(file).time_since_epoch().count();
+            header.source_size = fs::file_size(file);
+            header.path_length = relative_path.size();
+
+            auto cache_file = plugin_directory / BYTECODE_CACHE_DIRECTORY / fmt::format("{:016x}.luac", fnv1a_hash(relative_path));
+            if(load_cache_entry(state, cache_file, header, relative_path, chunk_name)) {
+                return LUA_OK;
+            }
+
+            int status = luaL_loadfile(state, file_name.c_str());
+            if(status == LUA_OK) {
+                try {
+                    save_cache_entry(state, cache_file, header, relative_path);
+                }
+                catch(std::exception &e) {
+                    logger.debug("Could not cache bytecode of {}: {}", file_name, e.what());
+                }
+            }
+            return status;
+        }
+        catch(std::exception &e) {
+            logger.debug("Bytecode cache is not available for {}: {}", file_name, e.what());
+            return luaL_loadfile(state, file_name.c_str());
+        }
+    }
+
+    static int cached_module_searcher(lua_State *state) noexcept {
+        const char *name = luaL_checkstring(state, 1);
+        lua_getglobal(state, "package");
+        if(!lua_istable(state, -1)) {
+            lua_pushstring(state, "\n\tpackage table is not available");
+            return 1;
+        }
+        lua_getfield(state, -1, "searchpath");
+        lua_pushstring(state, name);
+        lua_getfield(state, -3, "path");
+        if(!lua_isfunction(state, -3) || !lua_isstring(state, -1)) {
+            lua_pushstring(state, "\n\tpackage.path is not available");
+            return 1;
+        }
+        lua_call(state, 2, 2);
+        if(lua_isnil(state, -2)) {
+            return 1; // error message from searchpath
+        }
+        lua_pop(state, 1);
+
+        // Scoped so the paths are freed before luaL_error jumps out
+        int status;
+        {
+            fs::path file = lua_tostring(state, -1);
+            fs::path plugin_directory = lua_tostring(state, lua_upvalueindex(1));
+            status = load_cached_lua_file(state, plugin_directory, file);
+        }
+        if(status != LUA_OK) {
+            return luaL_error(state, "error loading module '%s' from file '%s':\n\t%s", name, lua_tostring(state, -2), lua_tostring(state, -1));
+        }
+        lua_pushvalue(state, -2); // file name
+        return 2;
+    }
+
+    void set_up_cached_module_searcher(lua_State *state, const fs::path &plugin_directory) noexcept {
+        lua_getglobal(state, "package");
+        lua_getfield(state, -1, "searchers");
+        if(lua_istable(state, -1)) {
+            lua_pushstring(state, plugin_directory.string().c_str());
+            lua_pushcclosure(state, cached_module_searcher, 1);
+            lua_rawseti(state, -2, 2);
+        }
+        lua_pop(state, 2);
+    }
+}
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef BALLTZE__PLUGINS__BYTECODE_CACHE_HPP
+#define BALLTZE__PLUGINS__BYTECODE_CACHE_HPP
+
+#include <filesystem>
+#include <lua.hpp>
+
+namespace Balltze::Plugins {
+    /**
+     * Load a Lua file of a plugin, using the compiled chunk in the plugin's bytecode cache if it is up to date.
+     * Files are compiled and cached otherwise. Cache entries are keyed by the path of the file relative to the
+     * plugin directory, and they are stale once the size or modification time of the file changes.
+     * Files outside the plugin directory are loaded as usual.
+     * 
+     * @param state the Lua state
+     * @param plugin_directory the directory of the plugin
+     * @param file the file to load
+     * @return the status of the load, like luaL_loadfile; the chunk or an error message is pushed
+     */
+    int load_cached_lua_file(lua_State *state, const std::filesystem::path &plugin_directory, const std::filesystem::path &file) noexcept;
+
+    /**
+     * Replace the Lua file searcher of require, so modules of the plugin are loaded through the bytecode cache.
+     * 
+     * @param state the Lua state
+     * @param plugin_directory the directory of the plugin
+     */
+    void set_up_cached_module_searcher(lua_State *state, const std::filesystem::path &plugin_directory) noexcept;
+}
+
+#endif
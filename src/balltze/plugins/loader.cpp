@@ -1,17 +1,44 @@
 // SPDX-License-Identifier: GPL-3.0-only
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
 #include <balltze/events.hpp>
+#include <impl/terminal/terminal.h>
 #include "../command/command.hpp"
 #include "../logger.hpp"
 #include "plugin.hpp"
 #include "loader.hpp"
 
+#define DEFAULT_LUA_GC_FRAME_BUDGET 500
+#define LUA_GC_MIN_STEP_SIZE 4
+#define LUA_GC_MAX_STEP_SIZE 64
+
 using namespace Balltze::Events;
 
 namespace Balltze::Plugins {
     static bool reload_plugins_on_next_tick = false;
     static std::vector<std::unique_ptr<Plugin>> plugins;
 
+    /**
+     * Garbage collector pacing of a Lua plugin state
+     */
+    struct LuaGarbageCollectorState {
+        /** Heap size after the last frame's steps, in KB */
+        std::size_t last_heap_size;
+
+        /** Work of every step, in KB; follows the allocation rate of the state, and is kept small so a single step stays well within the frame budget */
+        std::size_t step_size = LUA_GC_MIN_STEP_SIZE;
+
+        /** Was the state seen on the last frame? */
+        bool seen;
+    };
+
+    static std::unordered_map<lua_State *, LuaGarbageCollectorState> lua_gc_states;
+    static std::chrono::microseconds lua_gc_frame_budget(DEFAULT_LUA_GC_FRAME_BUDGET);
+    static std::size_t lua_memory_limit = 0;
+
     static bool plugin_is_global(Plugin *plugin) noexcept {
         return plugin->maps().empty();
     }
@@ -145,12 +172,100 @@ namespace Balltze::Plugins {
         }
     }
 
+    std::size_t get_lua_plugins_memory_limit() noexcept {
+        return lua_memory_limit;
+    }
+
+    static double to_kilobytes(std::size_t bytes) noexcept {
+        return bytes / 1024.0;
+    }
+
+    static std::size_t lua_heap_size(lua_State *state) noexcept {
+        return lua_gc(state, LUA_GCCOUNT, 0);
+    }
+
+    /**
+     * Do incremental garbage collection on every Lua plugin state, in proportion to what each state
+     * allocated since the last frame. Idle states are skipped; states that allocated more than their step
+     * covers get more steps until they catch up or use up their share of the frame budget.
+     * Full collections only happen on map load.
+     */
     static void lua_plugins_collect_garbage(FrameEndEvent const &context) noexcept {
-        auto lua_plugins = get_lua_plugins();
-        for(auto &plugin : lua_plugins) {
-            auto *state = plugin->lua_state();
+        if(lua_gc_frame_budget.count() == 0) {
+            return;
+        }
+
+        std::size_t state_count = 0;
+        for(auto &plugin : plugins) {
+            auto *lua_plugin = dynamic_cast<LuaPlugin *>(plugin.get());
+            if(lua_plugin && lua_plugin->lua_state()) {
+                state_count++;
+            }
+        }
+        if(state_count == 0) {
+            lua_gc_states.clear();
+            return;
+        }
+
+        auto slice = lua_gc_frame_budget / state_count;
+        for(auto &[state, gc_state] : lua_gc_states) {
+            gc_state.seen = false;
+        }
+
+        for(auto &plugin : plugins) {
+            auto *lua_plugin = dynamic_cast<LuaPlugin *>(plugin.get());
+            auto *state = lua_plugin ? lua_plugin->lua_state() : nullptr;
+            if(!state) {
+                continue;
+            }
+
+            auto heap_size = lua_heap_size(state);
+            auto [it, inserted] = lua_gc_states.try_emplace(state, LuaGarbageCollectorState{ heap_size });
+            auto &gc_state = it->second;
+            gc_state.seen = true;
+
+            // Aim at twice what was allocated since the last frame, smoothed over a few frames
+            std::size_t allocated = heap_size > gc_state.last_heap_size ? heap_size - gc_state.last_heap_size : 0;
+            gc_state.step_size = (gc_state.step_size * 3 + allocated * 2) / 4;
+            gc_state.step_size = std::clamp<std::size_t>(gc_state.step_size, LUA_GC_MIN_STEP_SIZE, LUA_GC_MAX_STEP_SIZE);
+
+            // Idle states are left to Lua's own pacing and the full collection on map load
+            if(allocated == 0) {
+                gc_state.last_heap_size = heap_size;
+                continue;
+            }
+
+            // The deadline only caps the work; a state that keeps up is done after its first step
+            auto deadline = std::chrono::steady_clock::now() + slice;
+            std::size_t work = 0;
+            do {
+                if(lua_gc(state, LUA_GCSTEP, gc_state.step_size)) {
+                    break;
+                }
+                work += gc_state.step_size;
+            } while(work < allocated * 2 && std::chrono::steady_clock::now() < deadline);
+
+            gc_state.last_heap_size = lua_heap_size(state);
+        }
+
+        std::erase_if(lua_gc_states, [](auto &entry) {
+            return !entry.second.seen;
+        });
+    }
+
+    /**
+     * Do a full collection on every Lua plugin state; only done on map load, where a pause goes unnoticed
+     */
+    static void lua_plugins_collect_all_garbage() noexcept {
+        for(auto &plugin : plugins) {
+            auto *lua_plugin = dynamic_cast<LuaPlugin *>(plugin.get());
+            auto *state = lua_plugin ? lua_plugin->lua_state() : nullptr;
             if(state) {
                 lua_gc(state, LUA_GCCOLLECT, 0);
+                auto it = lua_gc_states.find(state);
+                if(it != lua_gc_states.end()) {
+                    it->second.last_heap_size = lua_heap_size(state);
+                }
             }
         }
     }
@@ -160,6 +275,7 @@ namespace Balltze::Plugins {
         load_global_plugins();
         unload_map_plugins();
         load_map_plugins(map_name);
+        lua_plugins_collect_all_garbage();
     }
 
     static void initialize_plugins() {
@@ -216,5 +332,86 @@ namespace Balltze::Plugins {
             })
             .is_core()
             .create(COMMAND_SOURCE_BALLTZE);
+
+        CommandBuilder()
+            .name("lua_gc_budget")
+            .category("plugins")
+            .help("Sets the microseconds per frame spent collecting garbage of Lua plugins. 0 leaves it to Lua.")
+            .param(HSC_DATA_TYPE_LONG, "microseconds")
+            .function([](const std::vector<std::string> &args) -> bool {
+                auto budget = std::stol(args[0]);
+                if(budget < 0) {
+                    terminal_error_printf("Budget must not be negative");
+                    return false;
+                }
+                lua_gc_frame_budget = std::chrono::microseconds(budget);
+                terminal_info_printf("Lua garbage collection budget is %ld us per frame", budget);
+                return true;
+            })
+            .autosave()
+            .default_value(std::to_string(DEFAULT_LUA_GC_FRAME_BUDGET))
+            .can_call_from_console()
+            .is_core()
+            .create(COMMAND_SOURCE_BALLTZE);
+
+        CommandBuilder()
+            .name("lua_memory_limit")
+            .category("plugins")
+            .help("Sets the megabytes the Lua state of every plugin can use. 0 means no limit.")
+            .param(HSC_DATA_TYPE_LONG, "megabytes")
+            .function([](const std::vector<std::string> &args) -> bool {
+                auto limit = std::stol(args[0]);
+                if(limit < 0) {
+                    terminal_error_printf("Limit must not be negative");
+                    return false;
+                }
+                if(static_cast<unsigned long>(limit) > SIZE_MAX / (1024 * 1024)) {
+                    terminal_error_printf("Limit must not be greater than %zu MB", SIZE_MAX / (1024 * 1024));
+                    return false;
+                }
+                lua_memory_limit = static_cast<std::size_t>(limit) * 1024 * 1024;
+                for(auto *plugin : get_lua_plugins()) {
+                    if(auto *allocator = plugin->lua_allocator()) {
+                        allocator->set_limit(lua_memory_limit);
+                    }
+                }
+                if(limit == 0) {
+                    terminal_info_printf("Lua plugins memory is not limited");
+                }
+                else {
+                    terminal_info_printf("Lua plugins memory limit is %ld MB per plugin", limit);
+                }
+                return true;
+            })
+            .autosave()
+            .default_value("0")
+            .can_call_from_console()
+            .is_core()
+            .create(COMMAND_SOURCE_BALLTZE);
+
+        CommandBuilder()
+            .name("lua_memory")
+            .category("plugins")
+            .help("Prints the memory used by the Lua state of every loaded plugin.")
+            .function([](const std::vector<std::string> &args) -> bool {
+                bool printed = false;
+                for(auto *plugin : get_lua_plugins()) {
+                    auto *allocator = plugin->lua_allocator();
+                    if(!allocator) {
+                        continue;
+                    }
+                    auto stats = allocator->stats();
+                    auto name = plugin->name();
+                    terminal_info_printf("%s: %.1f KB live (%zu blocks), %.1f KB peak, %.1f KB reserved, %llu allocations, %llu failed", name.c_str(), to_kilobytes(stats.live_bytes), stats.live_allocations, to_kilobytes(stats.peak_bytes), to_kilobytes(stats.reserved_bytes), stats.allocations, stats.failed_allocations);
+                    printed = true;
+                }
+                if(!printed) {
+                    terminal_info_printf("No Lua plugin is loaded");
+                }
+                return true;
+            })
+            .can_call_from_console()
+            .is_core()
+            .create(COMMAND_SOURCE_BALLTZE);
     }
 }
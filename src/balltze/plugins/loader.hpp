@@ -49,6 +49,13 @@ namespace Balltze::Plugins {
      */
     NativePlugin *get_dll_plugin(HMODULE module_handle) noexcept;
 
+    /**
+     * Get the most memory the Lua state of a plugin can use.
+     * 
+     * @return the limit in bytes, or 0 if there is no limit
+     */
+    std::size_t get_lua_plugins_memory_limit() noexcept;
+
     /**
      * Set up plugins loader.
      */
@@ -8,6 +8,8 @@
 #include "../lua/libraries/preloaded_libraries.hpp"
 #include "../logger.hpp"
 #include "../version.hpp"
+#include "bytecode_cache.hpp"
+#include "loader.hpp"
 #include "plugin.hpp"
 
 namespace Balltze::Plugins {
@@ -96,6 +98,12 @@ namespace Balltze::Plugins {
             throw std::runtime_error("Plugin already loaded: " + m_metadata.name);
         }
 
+        // Exported classes change layout between major versions, so older plugins would corrupt memory
+        if(m_metadata.target_api.major != balltze_version.major) {
+            m_load_failed = true;
+            throw std::runtime_error("Plugin " + m_metadata.name + " targets Balltze " + m_metadata.target_api.to_string() + ", which is not binary compatible with Balltze " + balltze_version.to_string());
+        }
+
         m_module_handle = LoadLibraryA(m_directory.string().c_str());
         if(!m_module_handle) {
             m_load_failed = true;
@@ -168,6 +176,10 @@ namespace Balltze::Plugins {
         return m_plugin_logger.get();
     }
 
+    Lua::PooledAllocator *LuaPlugin::lua_allocator() noexcept {
+        return m_lua_state ? m_lua_allocator.get() : nullptr;
+    }
+
     void LuaPlugin::load() {
         if(m_load_failed) {
             return;
@@ -180,7 +192,7 @@ namespace Balltze::Plugins {
         init_lua_state();
 
         auto script_path = m_directory / m_metadata.plugin_main;
-        if(luaL_loadfile(m_lua_state, script_path.string().c_str())) {
+        if(load_cached_lua_file(m_lua_state, m_directory, script_path)) {
             std::string error_msg = lua_tostring(m_lua_state, -1);
             lua_pop(m_lua_state, 1); 
             m_load_failed = true;
@@ -233,6 +245,7 @@ namespace Balltze::Plugins {
             }
             lua_close(m_lua_state);
             m_lua_state = nullptr;
+            m_lua_allocator.reset();
         }
         m_game_start_called = false;
         m_load_failed = false;
@@ -264,12 +277,18 @@ namespace Balltze::Plugins {
     }
 
     void LuaPlugin::init_lua_state() {
-        m_lua_state = luaL_newstate();
+        m_lua_allocator = std::make_unique<Lua::PooledAllocator>(get_lua_plugins_memory_limit());
+        m_lua_state = lua_newstate(Lua::PooledAllocator::allocate, m_lua_allocator.get());
         if(!m_lua_state) {
             throw std::runtime_error("Could not create Lua state for plugin: " + m_metadata.name);
         }
         
         auto *state = m_lua_state;
+        lua_atpanic(state, +[](lua_State *state) -> int {
+            auto *message = lua_tostring(state, -1);
+            logger.fatal("Unprotected error in Lua plugin: {}", message ? message : "unknown error");
+            return 0;
+        });
         luaL_openlibs(state);
         Lua::Api::open_balltze_api_v2(state);
         Lua::set_preloaded_libraries(state);
@@ -292,6 +311,8 @@ namespace Balltze::Plugins {
         lua_pushstring(state, new_lua_cpath.c_str());
         lua_setfield(state, -2, "cpath");
         lua_pop(state, 1);
+
+        set_up_cached_module_searcher(state, m_directory);
     }
 
     std::string LuaPlugin::pop_error_message() const noexcept {
@@ -12,6 +12,7 @@
 #include <balltze/legacy_api/engine/tag.hpp>
 #include <balltze/logger.hpp>
 #include <balltze/plugin.hpp>
+#include "../lua/helpers/allocator.hpp"
 
 namespace Balltze::Plugins {
     struct PluginMetadata {
@@ -210,6 +211,13 @@ namespace Balltze::Plugins {
          */
         Logger *plugin_logger() noexcept;
 
+        /**
+         * Get the memory allocator of the plugin's Lua state.
+         * 
+         * @return the allocator, or nullptr if there is no Lua state
+         */
+        Lua::PooledAllocator *lua_allocator() noexcept;
+
         /**
          * Load the plugin Lua script.
          * 
@@ -269,6 +277,7 @@ namespace Balltze::Plugins {
 
     private:
         lua_State *m_lua_state = nullptr;
+        std::unique_ptr<Lua::PooledAllocator> m_lua_allocator;
         std::vector<TagImport> m_tag_imports;
         std::unique_ptr<Logger> m_plugin_logger;
 
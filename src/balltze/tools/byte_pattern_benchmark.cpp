@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "../memory/byte_pattern.hpp"
+
+using namespace Balltze::Memory;
+
+struct BenchmarkPattern {
+    const char *name;
+    std::vector<short> bytes;
+};
+
+// A few signatures in the shape of the ones in memory.cpp
+static const BenchmarkPattern patterns[] = {
+    { "console_out", { 0x83, 0xEC, 0x10, 0x57, 0x8B, 0xF8, 0xA0, -1, -1, -1, -1, 0x84, 0xC0, 0xC7, 0x44, 0x24, 0x04, 0x00, 0x00, 0x80, 0x3F } },
+    { "on_tick", { -1, -1, -1, -1, -1, 0xA1, -1, -1, -1, -1, 0x8B, 0x50, 0x14, 0x8B, 0x48, 0x0C } },
+    { "map_header", { 0x81, 0x3D, -1, -1, -1, -1, -1, -1, -1, -1, 0x8B, 0x3D } },
+    { "create_object_function", { 0x56, 0x83, 0xCE, 0xFF, 0x85, 0xC9, 0x57 } },
+    { "widget_input_handler_call", { 0xE8, -1, -1, -1, -1, 0x38, 0x1D, -1, -1, -1, -1, 0x0F, 0x84, -1, -1, -1, -1, 0x38, 0x1D, -1, -1, -1, -1 } }
+};
+
+/**
+ * Reference implementation; this is the loop CodeFinder used for signatures with wildcards.
+ */
+static void find_legacy(const short *signature, std::size_t size, const std::uint8_t *memory, std::size_t length, std::vector<std::size_t> &offsets) {
+    for(std::size_t i = 0, j = 0; i < length - size; i++, j = 0) {
+        while(signature[j] == memory[i + j] || signature[j] == -1) {
+            if(++j == size) {
+                offsets.push_back(i);
+                break;
+            }
+        }
+    }
+}
+
+template<typename T>
+static double measure(std::size_t iterations, T function) {
+    auto start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < iterations; i++) {
+        function();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}
+
+static const char *matcher_name(BytePatternMatcher matcher) {
+    switch(matcher) {
+        case BYTE_PATTERN_MATCHER_SCALAR:
+            return "scalar";
+        case BYTE_PATTERN_MATCHER_SSE2:
+            return "sse2";
+        case BYTE_PATTERN_MATCHER_AVX2:
+            return "avx2";
+        default:
+            return "auto";
+    }
+}
+
+int main(int argc, char **argv) {
+    std::size_t buffer_size = 16 * 1024 * 1024;
+    std::size_t iterations = 10;
+    if(argc > 1) {
+        buffer_size = std::strtoull(argv[1], nullptr, 10) * 1024 * 1024;
+    }
+    if(argc > 2) {
+        iterations = std::strtoull(argv[2], nullptr, 10);
+    }
+    if(buffer_size == 0 || iterations == 0) {
+        std::fprintf(stderr, "Usage: %s [buffer size in MiB] [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // Synthetic code section biased towards common x86 opcode bytes
+    std::vector<std::uint8_t> buffer(buffer_size);
+    std::mt19937 random(0xBA117E);
+    const std::uint8_t common_bytes[] = { 0x00, 0x8B, 0x89, 0x83, 0xE8, 0x24, 0x44, 0xFF, 0x0F, 0x85, 0xC0, 0x74, 0x75 };
+    for(auto &byte : buffer) {
+        auto value = random();
+        byte = (value & 1) ? common_bytes[(value >> 1) % sizeof(common_bytes)] : static_cast<std::uint8_t>(value >> 8);
+    }
+
+    // Plant every pattern near the end of the buffer, so the whole buffer has to be walked
+    std::size_t plant_offset = buffer_size - 4096;
+    for(auto &pattern : patterns) {
+        for(std::size_t i = 0; i < pattern.bytes.size(); i++) {
+            if(pattern.bytes[i] != -1) {
+                buffer[plant_offset + i] = static_cast<std::uint8_t>(pattern.bytes[i]);
+            }
+        }
+        plant_offset += 64;
+    }
+
+    auto *memory = reinterpret_cast<const std::byte *>(buffer.data());
+    const BytePatternMatcher matchers[] = { BYTE_PATTERN_MATCHER_SCALAR, BYTE_PATTERN_MATCHER_SSE2, BYTE_PATTERN_MATCHER_AVX2 };
+    auto best_matcher = BytePattern::best_matcher();
+
+    std::printf("Buffer: %zu MiB, %zu iterations, best matcher: %s\n\n", buffer_size / 1024 / 1024, iterations, matcher_name(best_matcher));
+    std::printf("%-28s %10s %10s %10s %10s %8s\n", "pattern", "legacy ms", "scalar ms", "sse2 ms", "avx2 ms", "matches");
+
+    int result = EXIT_SUCCESS;
+    for(auto &pattern : patterns) {
+        BytePattern byte_pattern(pattern.bytes.data(), pattern.bytes.size());
+
+        std::vector<std::size_t> expected;
+        double legacy_time = measure(iterations, [&]() {
+            expected.clear();
+            find_legacy(pattern.bytes.data(), pattern.bytes.size(), buffer.data(), buffer.size(), expected);
+        });
+
+        double times[3] = {};
+        for(std::size_t m = 0; m < 3; m++) {
+            if(matchers[m] > best_matcher) {
+                times[m] = -1;
+                continue;
+            }
+
+            std::vector<std::size_t> offsets;
+            times[m] = measure(iterations, [&]() {
+                offsets.clear();
+                byte_pattern.find(memory, buffer.size(), offsets, std::numeric_limits<std::size_t>::max(), matchers[m]);
+            });
+
+            if(offsets != expected) {
+                std::fprintf(stderr, "%s: %s matcher found %zu matches, expected %zu\n", pattern.name, matcher_name(matchers[m]), offsets.size(), expected.size());
+                result = EXIT_FAILURE;
+            }
+        }
+
+        std::printf("%-28s %10.3f %10.3f %10.3f %10.3f %8zu\n", pattern.name, legacy_time, times[0], times[1], times[2], expected.size());
+    }
+
+    return result;
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include "../events/inline_callback.hpp"
+#include "../events/listener_table.hpp"
+
+using namespace Balltze::Events;
+
+#define LISTENER_COUNT 8
+
+static std::size_t allocations = 0;
+
+void *operator new(std::size_t size) {
+    allocations++;
+    if(auto *memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+struct BenchmarkEvent {
+    std::size_t value = 0;
+};
+
+__attribute__((noinline)) static void plain_listener(BenchmarkEvent &event) {
+    event.value++;
+}
+
+struct BenchmarkResult {
+    double nanoseconds_per_listener;
+    std::size_t allocations;
+};
+
+/**
+ * Dispatch an event through a listener table and time every listener call.
+ */
+template<typename Callback, typename Make>
+static BenchmarkResult run(std::size_t iterations, Make &&make_callback) {
+    ListenerTable<Callback> table;
+    for(std::size_t i = 0; i < LISTENER_COUNT; i++) {
+        table.add(make_callback(i), i % 4);
+    }
+
+    BenchmarkEvent event;
+    std::size_t allocations_before = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < iterations; i++) {
+        table.dispatch([&event](Callback &callback) {
+            callback(event);
+        });
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::size_t dispatch_allocations = allocations - allocations_before;
+
+    if(event.value == 0) {
+        std::fprintf(stderr, "Listeners were not called\n");
+    }
+    return { elapsed / (iterations * LISTENER_COUNT), dispatch_allocations };
+}
+
+template<typename Callback>
+static void run_all(const char *name, std::size_t iterations) {
+    auto function = run<Callback>(iterations, [](std::size_t) {
+        return Callback(std::function<void(BenchmarkEvent &)>(plain_listener));
+    });
+
+    auto small_capture = run<Callback>(iterations, [](std::size_t i) {
+        return Callback([i](BenchmarkEvent &event) {
+            event.value += i;
+        });
+    });
+
+    auto large_capture = run<Callback>(iterations, [](std::size_t i) {
+        std::array<std::size_t, 8> values = {};
+        values[0] = i;
+        return Callback([values](BenchmarkEvent &event) {
+            event.value += values[0] + 1;
+        });
+    });
+
+    std::printf("%-16s %10.3f %10.3f %10.3f %12zu\n", name, function.nanoseconds_per_listener, small_capture.nanoseconds_per_listener, large_capture.nanoseconds_per_listener, function.allocations + small_capture.allocations + large_capture.allocations);
+}
+
+int main(int argc, char **argv) {
+    std::size_t iterations = 2000000;
+    if(argc > 1) {
+        iterations = std::strtoull(argv[1], nullptr, 10);
+    }
+    if(iterations == 0) {
+        std::fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("%zu listeners, %zu dispatches; nanoseconds per listener call\n\n", static_cast<std::size_t>(LISTENER_COUNT), iterations);
+    std::printf("%-16s %10s %10s %10s %12s\n", "callback", "function", "small", "large", "allocations");
+    run_all<std::function<void(BenchmarkEvent &)>>("std::function", iterations);
+    run_all<InlineCallback<void(BenchmarkEvent &)>>("InlineCallback", iterations);
+    return EXIT_SUCCESS;
+}
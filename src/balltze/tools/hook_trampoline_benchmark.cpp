@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "../memory/hook_trampoline.hpp"
+
+#if defined(__i386__) || defined(_M_IX86)
+#define TRAMPOLINE_BENCHMARK_SUPPORTED
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+#endif
+
+using namespace Balltze::Memory;
+
+struct TrampolineInfo {
+    const char *name;
+    std::vector<std::uint8_t> prologue;
+    std::vector<std::uint8_t> epilogue;
+};
+
+template<typename Registers>
+static TrampolineInfo trampoline_info(const char *name) {
+    return {
+        name,
+        std::vector<std::uint8_t>(Registers::prologue.begin(), Registers::prologue.end()),
+        std::vector<std::uint8_t>(Registers::epilogue.begin(), Registers::epilogue.end())
+    };
+}
+
+#ifdef TRAMPOLINE_BENCHMARK_SUPPORTED
+
+static bool result_flag = false;
+
+__attribute__((noinline)) static bool trampoline_target() {
+    asm volatile("");
+    return true;
+}
+
+static std::uint8_t *allocate_executable_memory(std::size_t size) {
+#ifdef _WIN32
+    return reinterpret_cast<std::uint8_t *>(VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE));
+#else
+    auto *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return memory == MAP_FAILED ? nullptr : reinterpret_cast<std::uint8_t *>(memory);
+#endif
+}
+
+/**
+ * Build a function that runs a hook trampoline and returns, the same code a hook puts in its cave.
+ */
+static void (*build_trampoline(std::uint8_t *code, const TrampolineInfo &info, bool save_result))() {
+    std::size_t position = 0;
+    std::memcpy(code + position, info.prologue.data(), info.prologue.size());
+    position += info.prologue.size();
+
+    // call rel32
+    code[position++] = 0xE8;
+    auto offset = static_cast<std::int32_t>(reinterpret_cast<std::uintptr_t>(&trampoline_target) - reinterpret_cast<std::uintptr_t>(code + position + 4));
+    std::memcpy(code + position, &offset, sizeof(offset));
+    position += sizeof(offset);
+
+    if(save_result) {
+        // mov [m32], al
+        code[position++] = 0xA2;
+        auto address = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&result_flag));
+        std::memcpy(code + position, &address, sizeof(address));
+        position += sizeof(address);
+    }
+
+    std::memcpy(code + position, info.epilogue.data(), info.epilogue.size());
+    position += info.epilogue.size();
+    code[position] = 0xC3; // ret
+    return reinterpret_cast<void (*)()>(code);
+}
+
+static double time_calls(void (*function)(), std::size_t iterations) {
+    auto start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < iterations; i++) {
+        function();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+#endif
+
+int main(int argc, char **argv) {
+    std::size_t iterations = 10000000;
+    if(argc > 1) {
+        iterations = std::strtoull(argv[1], nullptr, 10);
+    }
+    if(iterations == 0) {
+        std::fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    TrampolineInfo trampolines[] = {
+        trampoline_info<TrampolineSaveNothing>("none"),
+        trampoline_info<TrampolineSaveCdecl>("cdecl"),
+        trampoline_info<TrampolineSaveAll>("all")
+    };
+
+    std::printf("%-8s %9s %16s %16s\n", "saved", "push/pop", "bytes (void)", "bytes (bool)");
+    for(auto &info : trampolines) {
+        auto void_size = info.prologue.size() + 5 + info.epilogue.size();
+        std::printf("%-8s %9zu %16zu %16zu\n", info.name, info.prologue.size() + info.epilogue.size(), void_size, void_size + 5);
+    }
+
+#ifdef TRAMPOLINE_BENCHMARK_SUPPORTED
+    auto *code = allocate_executable_memory(4096);
+    if(!code) {
+        std::fprintf(stderr, "Failed to allocate executable memory\n");
+        return EXIT_FAILURE;
+    }
+
+    // Plain call to the function; what every trampoline costs at least
+    TrampolineInfo baseline = { "call", {}, {} };
+    auto baseline_time = time_calls(build_trampoline(code, baseline, false), iterations);
+
+    std::printf("\n%-8s %12s %12s %14s\n", "saved", "ns (void)", "ns (bool)", "overhead (ns)");
+    std::printf("%-8s %12.3f %12s %14s\n", baseline.name, baseline_time, "-", "-");
+    for(std::size_t i = 0; i < sizeof(trampolines) / sizeof(trampolines[0]); i++) {
+        auto &info = trampolines[i];
+        auto *void_code = code + 256 + i * 128;
+        auto *bool_code = void_code + 64;
+        auto void_time = time_calls(build_trampoline(void_code, info, false), iterations);
+        auto bool_time = time_calls(build_trampoline(bool_code, info, true), iterations);
+        std::printf("%-8s %12.3f %12.3f %14.3f\n", info.name, void_time, bool_time, void_time - baseline_time);
+    }
+#else
+    std::printf("\nTrampolines can only be timed on 32-bit x86 builds\n");
+#endif
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <lua.hpp>
+
+/**
+ * Compiles a Lua source file into a binary chunk for a target whose size_t has a different width than the host
+ * one, so the embedded modules can be precompiled while cross compiling.
+ * The chunk is dumped by the host Lua and then rewritten field by field; in Lua 5.3 only the size_t size in the
+ * header and the lengths of long strings depend on it. The other sizes (int, Instruction, lua_Integer and
+ * lua_Number) are the same on every target Balltze is built for, and are copied as they are.
+ */
+
+#define LUA_SIGNATURE_SIZE (sizeof(LUA_SIGNATURE) - 1)
+#define LUAC_DATA_SIZE 6
+#define CHUNK_SHORT_STRING_CONSTANT 4
+#define CHUNK_LONG_STRING_CONSTANT (4 | (1 << 4))
+#define CHUNK_FLOAT_CONSTANT 3
+#define CHUNK_INTEGER_CONSTANT (3 | (1 << 4))
+
+class BytecodeConverter {
+public:
+    BytecodeConverter(const std::string &chunk, std::size_t target_size_t_size) : m_chunk(chunk), m_target_size_t_size(target_size_t_size) {}
+
+    std::string convert() {
+        header();
+        byte();
+        function();
+        if(m_position != m_chunk.size()) {
+            throw std::runtime_error("trailing data after the main function");
+        }
+        return m_output;
+    }
+
+private:
+    const std::string &m_chunk;
+    std::size_t m_position = 0;
+    std::string m_output;
+    std::size_t m_target_size_t_size;
+    std::size_t m_int_size = 0;
+    std::size_t m_size_t_size = 0;
+    std::size_t m_instruction_size = 0;
+    std::size_t m_integer_size = 0;
+    std::size_t m_number_size = 0;
+
+    const char *read(std::size_t size) {
+        if(size > m_chunk.size() - m_position) {
+            throw std::runtime_error("truncated chunk");
+        }
+        auto *data = m_chunk.data() + m_position;
+        m_position += size;
+        return data;
+    }
+
+    void copy(std::size_t size) {
+        m_output.append(read(size), size);
+    }
+
+    std::uint8_t byte() {
+        auto value = static_cast<std::uint8_t>(*read(1));
+        m_output.push_back(static_cast<char>(value));
+        return value;
+    }
+
+    std::uint64_t read_unsigned(std::size_t size) {
+        auto *data = reinterpret_cast<const unsigned char *>(read(size));
+        std::uint64_t value = 0;
+        for(std::size_t i = 0; i < size; i++) {
+            value |= static_cast<std::uint64_t>(data[i]) << (i * 8);
+        }
+        return value;
+    }
+
+    void write_unsigned(std::uint64_t value, std::size_t size) {
+        if(size < sizeof(value) && (value >> (size * 8)) != 0) {
+            throw std::runtime_error("value does not fit in the target size_t");
+        }
+        for(std::size_t i = 0; i < size; i++) {
+            m_output.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+        }
+    }
+
+    std::size_t count() {
+        auto value = read_unsigned(m_int_size);
+        write_unsigned(value, m_int_size);
+        if(value > m_chunk.size()) {
+            throw std::runtime_error("invalid count");
+        }
+        return static_cast<std::size_t>(value);
+    }
+
+    void header() {
+        if(std::memcmp(read(LUA_SIGNATURE_SIZE), LUA_SIGNATURE, LUA_SIGNATURE_SIZE) != 0) {
+            throw std::runtime_error("not a Lua binary chunk");
+        }
+        m_output.append(LUA_SIGNATURE);
+        copy(2 + LUAC_DATA_SIZE);
+        m_int_size = byte();
+        m_size_t_size = static_cast<std::uint8_t>(*read(1));
+        m_output.push_back(static_cast<char>(m_target_size_t_size));
+        m_instruction_size = byte();
+        m_integer_size = byte();
+        m_number_size = byte();
+        if(m_int_size > 8 || m_size_t_size > 8 || m_integer_size > 8) {
+            throw std::runtime_error("unsupported chunk format");
+        }
+        copy(m_integer_size + m_number_size);
+    }
+
+    void string() {
+        std::uint64_t size = static_cast<std::uint8_t>(*read(1));
+        if(size == 0xFF) {
+            size = read_unsigned(m_size_t_size);
+            m_output.push_back(static_cast<char>(0xFF));
+            write_unsigned(size, m_target_size_t_size);
+        }
+        else {
+            m_output.push_back(static_cast<char>(size));
+        }
+        if(size > 0) {
+            copy(static_cast<std::size_t>(size - 1));
+        }
+    }
+
+    void function() {
+        string();
+        copy(m_int_size * 2 + 3);
+
+        auto instruction_count = count();
+        copy(instruction_count * m_instruction_size);
+
+        auto constant_count = count();
+        for(std::size_t i = 0; i < constant_count; i++) {
+            switch(byte()) {
+                case LUA_TNIL:
+                    break;
+                case LUA_TBOOLEAN:
+                    byte();
+                    break;
+                case CHUNK_FLOAT_CONSTANT:
+                    copy(m_number_size);
+                    break;
+                case CHUNK_INTEGER_CONSTANT:
+                    copy(m_integer_size);
+                    break;
+                case CHUNK_SHORT_STRING_CONSTANT:
+                case CHUNK_LONG_STRING_CONSTANT:
+                    string();
+                    break;
+                default:
+                    throw std::runtime_error("unknown constant type");
+            }
+        }
+
+        auto upvalue_count = count();
+        copy(upvalue_count * 2);
+
+        auto prototype_count = count();
+        for(std::size_t i = 0; i < prototype_count; i++) {
+            function();
+        }
+
+        auto line_info_count = count();
+        copy(line_info_count * m_int_size);
+        auto local_variable_count = count();
+        for(std::size_t i = 0; i < local_variable_count; i++) {
+            string();
+            copy(m_int_size * 2);
+        }
+        auto upvalue_name_count = count();
+        for(std::size_t i = 0; i < upvalue_name_count; i++) {
+            string();
+        }
+    }
+};
+
+static int write_chunk(lua_State *, const void *data, std::size_t size, void *chunk) {
+    static_cast<std::string *>(chunk)->append(static_cast<const char *>(data), size);
+    return 0;
+}
+
+static void print_usage(const char *program) {
+    std::fprintf(stderr, "Usage: %s [--strip] [--size-t <bytes>] <input.lua> <output.luac> <chunk name>\n", program);
+}
+
+int main(int argc, char **argv) {
+    bool strip = false;
+    std::size_t size_t_size = sizeof(std::size_t);
+    std::vector<const char *> paths;
+    for(int i = 1; i < argc; i++) {
+        if(std::strcmp(argv[i], "--strip") == 0) {
+            strip = true;
+        }
+        else if(std::strcmp(argv[i], "--size-t") == 0 && i + 1 < argc) {
+            size_t_size = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else {
+            paths.push_back(argv[i]);
+        }
+    }
+    if(paths.size() != 3 || (size_t_size != 4 && size_t_size != 8)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream input(paths[0], std::ios::binary);
+    if(!input) {
+        std::fprintf(stderr, "Could not open %s\n", paths[0]);
+        return EXIT_FAILURE;
+    }
+    std::string source((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    lua_State *state = luaL_newstate();
+    if(luaL_loadbufferx(state, source.data(), source.size(), paths[2], "t") != LUA_OK) {
+        std::fprintf(stderr, "%s\n", lua_tostring(state, -1));
+        lua_close(state);
+        return EXIT_FAILURE;
+    }
+    std::string chunk;
+    lua_dump(state, write_chunk, &chunk, strip);
+    lua_close(state);
+
+    std::string output_chunk;
+    try {
+        output_chunk = BytecodeConverter(chunk, size_t_size).convert();
+    }
+    catch(std::runtime_error &e) {
+        std::fprintf(stderr, "Could not convert %s: %s\n", paths[0], e.what());
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream output(paths[1], std::ios::binary | std::ios::trunc);
+    output.write(output_chunk.data(), output_chunk.size());
+    if(!output) {
+        std::fprintf(stderr, "Could not write %s\n", paths[1]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "../memory/byte_pattern.hpp"
+#include "../memory/signature_scanner.hpp"
+#include "../memory/signature_table.hpp"
+
+using namespace Balltze::Memory;
+
+#define MAX_PRINTED_OFFSETS 4
+
+struct ExecutableSection {
+    std::uint64_t image_base;
+    std::uint32_t virtual_address;
+    std::size_t file_offset;
+    std::size_t size;
+};
+
+template<typename T>
+static T read_value(const std::vector<std::uint8_t> &file, std::size_t offset) {
+    if(offset + sizeof(T) > file.size()) {
+        throw std::runtime_error("Unexpected end of file");
+    }
+    T value;
+    std::memcpy(&value, file.data() + offset, sizeof(T));
+    return value;
+}
+
+/**
+ * Find the first executable section of a PE image, the same one the game code section lookup uses.
+ */
+static std::optional<ExecutableSection> find_executable_section(const std::vector<std::uint8_t> &file) {
+    if(read_value<std::uint16_t>(file, 0x0) != 0x5A4D) {
+        throw std::runtime_error("Missing DOS header");
+    }
+    auto nt_header = read_value<std::uint32_t>(file, 0x3C);
+    if(read_value<std::uint32_t>(file, nt_header) != 0x00004550) {
+        throw std::runtime_error("Missing PE header");
+    }
+
+    auto section_count = read_value<std::uint16_t>(file, nt_header + 0x6);
+    auto optional_header_size = read_value<std::uint16_t>(file, nt_header + 0x14);
+    auto optional_header = nt_header + 0x18;
+
+    ExecutableSection section;
+    switch(read_value<std::uint16_t>(file, optional_header)) {
+        case 0x10B:
+            section.image_base = read_value<std::uint32_t>(file, optional_header + 0x1C);
+            break;
+        case 0x20B:
+            section.image_base = read_value<std::uint64_t>(file, optional_header + 0x18);
+            break;
+        default:
+            throw std::runtime_error("Unknown optional header type");
+    }
+
+    auto section_header = optional_header + optional_header_size;
+    for(std::size_t i = 0; i < section_count; i++, section_header += 0x28) {
+        auto characteristics = read_value<std::uint32_t>(file, section_header + 0x24);
+        if(characteristics & 0x20000000) {
+            section.virtual_address = read_value<std::uint32_t>(file, section_header + 0xC);
+            section.size = read_value<std::uint32_t>(file, section_header + 0x10);
+            section.file_offset = read_value<std::uint32_t>(file, section_header + 0x14);
+            if(section.file_offset + section.size > file.size()) {
+                throw std::runtime_error("Executable section is out of bounds");
+            }
+            return section;
+        }
+    }
+    return std::nullopt;
+}
+
+static const char *group_name(SignatureGroup group) {
+    switch(group) {
+        case SIGNATURE_GROUP_CORE:
+            return "core";
+        case SIGNATURE_GROUP_CLIENT:
+            return "client";
+        case SIGNATURE_GROUP_DEDICATED_SERVER:
+            return "server";
+        default:
+            return "unknown";
+    }
+}
+
+static BytePattern signature_byte_pattern(SignatureId id) {
+    auto &pattern = get_signature_definition(id).pattern;
+    return BytePattern(pattern.values.data(), pattern.mask.data(), pattern.size);
+}
+
+/**
+ * Resolve every signature with a single-pass scanner, as the game does on startup.
+ */
+static double scan_signatures(const std::byte *memory, std::size_t length, std::size_t threads, std::vector<std::optional<std::size_t>> &results) {
+    SignatureScanner scanner;
+    for(std::size_t i = 0; i < SIGNATURE_COUNT; i++) {
+        scanner.add_pattern(signature_byte_pattern(static_cast<SignatureId>(i)));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    scanner.scan(memory, length, threads);
+    auto end = std::chrono::steady_clock::now();
+
+    results.clear();
+    for(std::size_t i = 0; i < SIGNATURE_COUNT; i++) {
+        results.push_back(scanner.match(i));
+    }
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(int argc, char **argv) {
+    if(argc < 2 || argc > 3) {
+        std::fprintf(stderr, "Usage: %s <executable> [threads]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    if(argc > 2) {
+        threads = std::strtoull(argv[2], nullptr, 10);
+        if(threads == 0) {
+            std::fprintf(stderr, "Invalid thread count %s\n", argv[2]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::ifstream input(argv[1], std::ios::binary);
+    if(!input.is_open()) {
+        std::fprintf(stderr, "Failed to open %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    std::vector<std::uint8_t> file((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    std::optional<ExecutableSection> section;
+    try {
+        section = find_executable_section(file);
+    }
+    catch(std::runtime_error &e) {
+        std::fprintf(stderr, "%s is not a valid PE image: %s\n", argv[1], e.what());
+        return EXIT_FAILURE;
+    }
+    if(!section) {
+        std::fprintf(stderr, "%s has no executable section\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    auto *memory = reinterpret_cast<const std::byte *>(file.data() + section->file_offset);
+    std::printf("Executable section: RVA 0x%08X, %zu bytes, image base 0x%08llX\n\n", section->virtual_address, section->size, static_cast<unsigned long long>(section->image_base));
+    std::printf("%-64s %-7s %7s %9s  %s\n", "signature", "group", "matches", "find ms", "addresses");
+
+    // Every match of every signature, one by one; the game uses the first match
+    bool group_found[3] = { true, true, true };
+    std::size_t ambiguous = 0;
+    for(std::size_t i = 0; i < SIGNATURE_COUNT; i++) {
+        auto &definition = get_signature_definition(static_cast<SignatureId>(i));
+        auto pattern = signature_byte_pattern(definition.id);
+
+        std::vector<std::size_t> offsets;
+        auto start = std::chrono::steady_clock::now();
+        pattern.find(memory, section->size, offsets);
+        auto find_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if(offsets.empty()) {
+            group_found[definition.group] = false;
+        }
+        else if(offsets.size() > 1) {
+            ambiguous++;
+        }
+
+        std::printf("%-64s %-7s %7zu %9.3f ", definition.name, group_name(definition.group), offsets.size(), find_time);
+        for(std::size_t o = 0; o < offsets.size() && o < MAX_PRINTED_OFFSETS; o++) {
+            std::printf(" 0x%08llX", static_cast<unsigned long long>(section->image_base + section->virtual_address + offsets[o] + definition.offset));
+        }
+        if(offsets.size() > MAX_PRINTED_OFFSETS) {
+            std::printf(" ...");
+        }
+        std::printf("\n");
+    }
+
+    std::vector<std::optional<std::size_t>> serial_results;
+    std::vector<std::optional<std::size_t>> threaded_results;
+    auto serial_time = scan_signatures(memory, section->size, 1, serial_results);
+    auto threaded_time = scan_signatures(memory, section->size, threads, threaded_results);
+
+    std::printf("\nScanner: %.3f ms serial, %.3f ms with %zu threads\n", serial_time, threaded_time, threads);
+    std::printf("Ambiguous signatures: %zu\n", ambiguous);
+
+    int result = EXIT_SUCCESS;
+    if(serial_results != threaded_results) {
+        std::fprintf(stderr, "Serial and threaded scans resolved different offsets\n");
+        result = EXIT_FAILURE;
+    }
+
+    // Same rules the game uses to pick a side
+    if(group_found[SIGNATURE_GROUP_CORE] && group_found[SIGNATURE_GROUP_CLIENT]) {
+        std::printf("All client signatures found\n");
+    }
+    else if(group_found[SIGNATURE_GROUP_CORE] && group_found[SIGNATURE_GROUP_DEDICATED_SERVER]) {
+        std::printf("All dedicated server signatures found\n");
+    }
+    else {
+        std::fprintf(stderr, "Missing signatures; Balltze would fail to load with this executable\n");
+        result = EXIT_FAILURE;
+    }
+    return result;
+}
@@ -1,9 +1,56 @@
 # SPDX-License-Identifier: GPL-3.0-only
 
-add_executable(lua-types-dump
-    $<TARGET_OBJECTS:balltze>
-    src/balltze/tools/lua_types_dump.cpp
-)
+if(WIN32)
+    add_executable(lua-types-dump
+        $<TARGET_OBJECTS:balltze>
+        src/balltze/tools/lua_types_dump.cpp
+    )
 
-target_link_libraries(lua-types-dump PRIVATE ringworld chimera lua53 fmt invader luastruct lanes lua-fmt lua-memory-snapshot d3d9 gdiplus ws2_32 version)
-set_target_properties(lua-types-dump PROPERTIES LINK_FLAGS "-static -static-libgcc -static-libstdc++")
+    target_link_libraries(lua-types-dump PRIVATE ringworld chimera lua53 fmt invader luastruct lanes lua-fmt lua-memory-snapshot d3d9 gdiplus ws2_32 version)
+    set_target_properties(lua-types-dump PROPERTIES LINK_FLAGS "-static -static-libgcc -static-libstdc++")
+endif()
+
+# Native tools; these only use the platform independent parts of Balltze. The DLL build gets the bytecode
+# compiler from the native-tools project, so they are not built for Windows.
+if(NOT WIN32 OR BALLTZE_NATIVE_TOOLS_ONLY)
+    add_executable(byte-pattern-benchmark
+        src/balltze/memory/byte_pattern.cpp
+        src/balltze/tools/byte_pattern_benchmark.cpp
+    )
+
+    find_package(Threads REQUIRED)
+
+    add_executable(signature-verify
+        src/balltze/memory/byte_pattern.cpp
+        src/balltze/memory/signature_scanner.cpp
+        src/balltze/memory/signature_table.cpp
+        src/balltze/tools/signature_verify.cpp
+    )
+
+    target_link_libraries(signature-verify PRIVATE Threads::Threads)
+
+    add_executable(x86-decoder-benchmark
+        src/balltze/memory/x86_decoder.cpp
+        src/balltze/tools/x86_decoder_benchmark.cpp
+    )
+
+    add_executable(hook-trampoline-benchmark
+        src/balltze/tools/hook_trampoline_benchmark.cpp
+    )
+
+    add_executable(event-callback-benchmark
+        src/balltze/tools/event_callback_benchmark.cpp
+    )
+
+    # Lua for the native tools
+    file(GLOB LUA_NATIVE_SOURCES lib/lua/*.c)
+    list(REMOVE_ITEM LUA_NATIVE_SOURCES ${CMAKE_CURRENT_SOURCE_DIR}/lib/lua/lua.c ${CMAKE_CURRENT_SOURCE_DIR}/lib/lua/luac.c)
+    add_library(lua53-native STATIC ${LUA_NATIVE_SOURCES})
+    target_include_directories(lua53-native PUBLIC ${CMAKE_CURRENT_SOURCE_DIR}/include/lua)
+
+    add_executable(lua-bytecode-compiler
+        src/balltze/tools/lua_bytecode_compiler.cpp
+    )
+
+    target_link_libraries(lua-bytecode-compiler PRIVATE lua53-native ${CMAKE_DL_LIBS})
+endif()
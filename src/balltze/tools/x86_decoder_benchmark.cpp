@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "../memory/signature_table.hpp"
+#include "../memory/x86_decoder.hpp"
+
+using namespace Balltze::Memory;
+
+struct CorpusInstruction {
+    const char *bytes;
+    std::size_t length;
+    std::size_t relative_size;
+};
+
+// Instructions found at our hook sites, plus prefixes, SIB and displacement forms
+static const CorpusInstruction corpus[] = {
+    { "E8 10 20 30 40", 5, 4 },                 // call rel32
+    { "E9 10 20 30 40", 5, 4 },                 // jmp rel32
+    { "EB 10", 2, 1 },                          // jmp rel8
+    { "74 0A", 2, 1 },                          // je rel8
+    { "0F 87 10 20 30 40", 6, 4 },              // ja rel32
+    { "E3 05", 2, 1 },                          // jecxz rel8
+    { "C6 44 24 12 01", 5, 0 },                 // mov byte ptr [esp + 0x12], 1
+    { "8A 47 04", 3, 0 },                       // mov al, byte ptr [edi + 4]
+    { "8A 07", 2, 0 },                          // mov al, byte ptr [edi]
+    { "84 C0", 2, 0 },                          // test al, al
+    { "FF 92 A8 00 00 00", 6, 0 },              // call dword ptr [edx + 0xA8]
+    { "FF 52 40", 3, 0 },                       // call dword ptr [edx + 0x40]
+    { "FF 24 85 10 20 30 40", 7, 0 },           // jmp dword ptr [eax * 4 + disp32]
+    { "FF 15 10 20 30 40", 6, 0 },              // call dword ptr [disp32]
+    { "85 C0", 2, 0 },                          // test eax, eax
+    { "0F B6 47 04", 4, 0 },                    // movzx eax, byte ptr [edi + 4]
+    { "0F BF C1", 3, 0 },                       // movsx eax, cx
+    { "0F 94 C1", 3, 0 },                       // sete cl
+    { "66 39 46 04", 4, 0 },                    // cmp word ptr [esi + 4], ax
+    { "66 FF 05 10 20 30 40", 7, 0 },           // inc word ptr [disp32]
+    { "66 C7 00 01 00", 5, 0 },                 // mov word ptr [eax], 1
+    { "66 8B 0D 10 20 30 40", 7, 0 },           // mov cx, word ptr [disp32]
+    { "66 89 78 04", 4, 0 },                    // mov word ptr [eax + 4], di
+    { "3C FF", 2, 0 },                          // cmp al, 0xFF
+    { "48", 1, 0 },                             // dec eax
+    { "83 F8 09", 3, 0 },                       // cmp eax, 9
+    { "83 C4 08", 3, 0 },                       // add esp, 8
+    { "83 EC 10", 3, 0 },                       // sub esp, 0x10
+    { "90", 1, 0 },                             // nop
+    { "8D 4C 24 08", 4, 0 },                    // lea ecx, [esp + 8]
+    { "8B 84 24 9C 00 00 00", 7, 0 },           // mov eax, dword ptr [esp + 0x9C]
+    { "8B 0D 10 20 30 40", 6, 0 },              // mov ecx, dword ptr [disp32]
+    { "8D 34 40", 3, 0 },                       // lea esi, [eax + eax * 2]
+    { "89 72 38", 3, 0 },                       // mov dword ptr [edx + 0x38], esi
+    { "89 3D 10 20 30 40", 6, 0 },              // mov dword ptr [disp32], edi
+    { "57", 1, 0 },                             // push edi
+    { "81 EC 94 00 00 00", 6, 0 },              // sub esp, 0x94
+    { "81 FD FF 7F 00 00", 6, 0 },              // cmp ebp, 0x7FFF
+    { "A1 10 20 30 40", 5, 0 },                 // mov eax, dword ptr [moffs32]
+    { "32 DB", 2, 0 },                          // xor bl, bl
+    { "25 FF FF 00 00", 5, 0 },                 // and eax, 0xFFFF
+    { "68 10 20 30 40", 5, 0 },                 // push imm32
+    { "6A FF", 2, 0 },                          // push -1
+    { "80 3D 10 20 30 40 01", 7, 0 },           // cmp byte ptr [disp32], 1
+    { "C7 44 24 04 00 00 80 3F", 8, 0 },        // mov dword ptr [esp + 4], imm32
+    { "C7 04 25 10 20 30 40 01 00 00 00", 11, 0 }, // mov dword ptr [disp32 + eiz], imm32 (SIB without base)
+    { "F6 C4 44", 3, 0 },                       // test ah, 0x44
+    { "F7 D8", 2, 0 },                          // neg eax
+    { "F7 C1 10 20 30 40", 6, 0 },              // test ecx, imm32
+    { "D9 05 10 20 30 40", 6, 0 },              // fld dword ptr [disp32]
+    { "DD 5C 24 10", 4, 0 },                    // fstp qword ptr [esp + 0x10]
+    { "F3 A5", 2, 0 },                          // rep movsd
+    { "F3 0F 10 44 24 04", 6, 0 },              // movss xmm0, dword ptr [esp + 4]
+    { "66 0F 3A 0F C1 08", 6, 0 },              // palignr xmm0, xmm1, 8
+    { "66 0F 38 00 C1", 5, 0 },                 // pshufb xmm0, xmm1
+    { "0F A4 C2 04", 4, 0 },                    // shld edx, eax, 4
+    { "66 B8 34 12", 4, 0 },                    // mov ax, 0x1234
+    { "67 8B 46 10", 4, 0 },                    // mov eax, dword ptr [bp + 0x10]
+    { "67 A1 10 20", 4, 0 },                    // mov eax, dword ptr [moffs16]
+    { "C2 08 00", 3, 0 },                       // ret 8
+    { "C8 10 00 00", 4, 0 },                    // enter 0x10, 0
+    { "9A 10 20 30 40 08 00", 7, 0 },           // call far ptr16:32
+    { "64 A1 30 00 00 00", 6, 0 },              // mov eax, dword ptr fs:[0x30]
+    { "F0 0F B1 0A", 4, 0 },                    // lock cmpxchg dword ptr [edx], ecx
+    { "0F 31", 2, 0 },                          // rdtsc
+    { "CC", 1, 0 }                              // int3
+};
+
+// Bytes that must not decode
+static const char *invalid_corpus[] = {
+    "0F 04",                                    // undefined
+    "0F 0A",                                    // undefined
+    "8B",                                       // truncated ModRM
+    "E8 10 20",                                 // truncated displacement
+    "66 66 66 66 66 66 66 66 66 66 66 66 66 66 66 90" // longer than 15 bytes
+};
+
+static std::vector<std::uint8_t> parse_bytes(const char *bytes) {
+    std::vector<std::uint8_t> data;
+    parse_signature_pattern(bytes, [&data](short byte) {
+        data.push_back(static_cast<std::uint8_t>(byte));
+    });
+    return data;
+}
+
+int main(int argc, char **argv) {
+    std::size_t iterations = 100000;
+    if(argc > 1) {
+        iterations = std::strtoull(argv[1], nullptr, 10);
+    }
+    if(iterations == 0) {
+        std::fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int result = EXIT_SUCCESS;
+    std::vector<std::uint8_t> stream;
+    std::size_t instruction_count = 0;
+
+    for(auto &entry : corpus) {
+        auto bytes = parse_bytes(entry.bytes);
+        X86Instruction instruction;
+        if(!decode_x86_instruction(bytes.data(), bytes.size(), instruction)) {
+            std::fprintf(stderr, "%s: failed to decode\n", entry.bytes);
+            result = EXIT_FAILURE;
+            continue;
+        }
+        if(instruction.length != entry.length || instruction.relative_size != entry.relative_size) {
+            std::fprintf(stderr, "%s: decoded length %zu (relative %zu), expected %zu (relative %zu)\n", entry.bytes, instruction.length, instruction.relative_size, entry.length, entry.relative_size);
+            result = EXIT_FAILURE;
+        }
+        stream.insert(stream.end(), bytes.begin(), bytes.end());
+        instruction_count++;
+    }
+
+    for(auto *entry : invalid_corpus) {
+        auto bytes = parse_bytes(entry);
+        X86Instruction instruction;
+        if(decode_x86_instruction(bytes.data(), bytes.size(), instruction)) {
+            std::fprintf(stderr, "%s: decoded an invalid instruction (length %zu)\n", entry, instruction.length);
+            result = EXIT_FAILURE;
+        }
+    }
+
+    std::printf("Corpus: %zu instructions, %zu invalid sequences: %s\n", instruction_count, sizeof(invalid_corpus) / sizeof(invalid_corpus[0]), result == EXIT_SUCCESS ? "ok" : "FAILED");
+    if(result != EXIT_SUCCESS) {
+        return result;
+    }
+
+    // Decode the whole corpus as one instruction stream, like a hook walking a function prologue
+    std::size_t decoded_instructions = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < iterations; i++) {
+        std::size_t position = 0;
+        while(position < stream.size()) {
+            X86Instruction instruction;
+            if(!decode_x86_instruction(stream.data() + position, stream.size() - position, instruction)) {
+                std::fprintf(stderr, "Failed to decode the corpus stream at %zu\n", position);
+                return EXIT_FAILURE;
+            }
+            position += instruction.length;
+            decoded_instructions++;
+        }
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("Decoded %zu instructions in %.3f ms (%.2f ns per instruction)\n", decoded_instructions, elapsed / 1e6, elapsed / decoded_instructions);
+    return EXIT_SUCCESS;
+}
@@ -1,5 +1,5 @@
 #ifndef BALLTZE_VERSION
-#define BALLTZE_VERSION "1.3.4"
+#define BALLTZE_VERSION "2.0.0"
 #ifdef __cplusplus
 
 #include <semver/semver.hpp>